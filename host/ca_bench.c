@@ -0,0 +1,226 @@
+/**
+ * Per-phase microbenchmark of the generation pipeline
+ *
+ * Times each stage of calculer_generation_suivante in isolation (environment,
+ * neighbor collection, survival, birth, movement, VGA rendering into a RAM
+ * buffer) plus the full generation, over many iterations and fixed seeds.
+ * Before every timed iteration the grid is restored from a snapshot taken after
+ * the warm-up, so each stage always sees the same density.
+ *
+ * Output is CSV on stdout (one line per seed and phase), ns/cell and cells/s
+ * being normalized by the full grid size for every phase.
+ *
+ * Usage : ca_bench [--largeur N] [--hauteur N] [--regles B3/S23] [--iterations N]
+ *                  [--prechauffage N] [--graine X]... [--init uniforme|centre|clusters]
+ *                  [--noyau scalaire|sse2] [--stockage auto|dense]
+ *
+ * --stockage dense keeps the full-grid generation even at low population, so
+ * large grids (e.g. --largeur 2048 --hauteur 2048) measure the dense pipeline
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ca.h"
+
+#define NOMBRE_GRAINES_MAX 16
+
+// Graines fixes utilisées quand aucune n'est fournie
+static const uint32_t GRAINES_PAR_DEFAUT[] = { 0x94215687, 0x00C0FFEE, 0x12345678 };
+
+typedef enum {
+    PHASE_ENVIRONNEMENT,
+    PHASE_VOISINAGE,
+    PHASE_SURVIE,
+    PHASE_NAISSANCE,
+    PHASE_MOUVEMENT,
+    PHASE_AFFICHAGE,
+    PHASE_GENERATION_COMPLETE,
+    NOMBRE_PHASES
+} PhaseMesuree;
+
+static const char *NOMS_PHASES[NOMBRE_PHASES] = {
+    "environnement", "voisinage", "survie", "naissance",
+    "mouvement", "affichage", "generation_complete"
+};
+
+// Copie figée de l'état après préchauffage
+typedef struct {
+    AutomateCellulaire automate;
+    uint8_t *memoire;
+} InstantaneAutomate;
+
+static uint64_t nanosecondes_monotones(void) {
+    struct timespec instant;
+    clock_gettime(CLOCK_MONOTONIC, &instant);
+    return (uint64_t)instant.tv_sec * 1000000000ull + (uint64_t)instant.tv_nsec;
+}
+
+// Toute la grille vit dans un seul bloc : une copie du bloc suffit.
+// La structure est aussi copiée car les buffers actuel/suivant sont échangés à chaque génération.
+static void sauvegarder_instantane(const AutomateCellulaire *automate, const uint8_t *memoire,
+                                   InstantaneAutomate *instantane, size_t taille_memoire) {
+    instantane->automate = *automate;
+    memcpy(instantane->memoire, memoire, taille_memoire);
+}
+
+static void restaurer_instantane(AutomateCellulaire *automate, uint8_t *memoire,
+                                 const InstantaneAutomate *instantane, size_t taille_memoire) {
+    *automate = instantane->automate;
+    memcpy(memoire, instantane->memoire, taille_memoire);
+}
+
+// Exécute une phase une fois et retourne sa durée ; la préparation n'est pas chronométrée
+static uint64_t mesurer_phase(PhaseMesuree phase, AutomateCellulaire *automate, uint8_t *memoire_affichage) {
+    if (phase == PHASE_SURVIE || phase == PHASE_NAISSANCE) {
+        executer_phase_voisinage(automate);
+        executer_phase_environnement(automate);
+    }
+
+    uint64_t debut = nanosecondes_monotones();
+    switch (phase) {
+        case PHASE_ENVIRONNEMENT:       executer_phase_environnement(automate); break;
+        case PHASE_VOISINAGE:           executer_phase_voisinage(automate); break;
+        case PHASE_SURVIE:              executer_phase_survie(automate); break;
+        case PHASE_NAISSANCE:           executer_phase_naissance(automate); break;
+        case PHASE_MOUVEMENT:           executer_phase_mouvement(automate); break;
+        case PHASE_AFFICHAGE:           afficher_grille_sur_ecran(automate, memoire_affichage); break;
+        case PHASE_GENERATION_COMPLETE: calculer_generation_suivante(automate); break;
+        default: break;
+    }
+    return nanosecondes_monotones() - debut;
+}
+
+static void afficher_usage(const char *programme) {
+    fprintf(stderr,
+            "usage: %s [--largeur N] [--hauteur N] [--regles B3/S23] [--iterations N]\n"
+            "          [--prechauffage N] [--graine X]... [--init uniforme|centre|clusters]\n"
+            "          [--noyau scalaire|sse2] [--stockage auto|dense]\n",
+            programme);
+}
+
+int main(int argc, char **argv) {
+    int largeur = 160;
+    int hauteur = 50;
+    const char *regles = REGLES_AUTOMATE;
+    uint32_t iterations = 50;
+    uint32_t prechauffage = 20;
+    uint32_t graines[NOMBRE_GRAINES_MAX];
+    int nombre_graines = 0;
+    TypeInitialisation type_init = INIT_ALEATOIRE_CLUSTERS;
+    StockageAutomate stockage = STOCKAGE_AUTOMATIQUE;
+
+    for (int i = 1; i < argc; i++) {
+        const char *option = argv[i];
+        if (i + 1 >= argc) {
+            afficher_usage(argv[0]);
+            return 1;
+        }
+        const char *valeur = argv[++i];
+
+        if (strcmp(option, "--largeur") == 0) {
+            largeur = (int)strtol(valeur, NULL, 0);
+        } else if (strcmp(option, "--hauteur") == 0) {
+            hauteur = (int)strtol(valeur, NULL, 0);
+        } else if (strcmp(option, "--regles") == 0) {
+            regles = valeur;
+        } else if (strcmp(option, "--iterations") == 0) {
+            iterations = (uint32_t)strtoul(valeur, NULL, 0);
+        } else if (strcmp(option, "--prechauffage") == 0) {
+            prechauffage = (uint32_t)strtoul(valeur, NULL, 0);
+        } else if (strcmp(option, "--graine") == 0 && nombre_graines < NOMBRE_GRAINES_MAX) {
+            graines[nombre_graines++] = (uint32_t)strtoul(valeur, NULL, 0);
+        } else if (strcmp(option, "--init") == 0) {
+            if (strcmp(valeur, "uniforme") == 0)      type_init = INIT_ALEATOIRE_UNIFORME;
+            else if (strcmp(valeur, "centre") == 0)   type_init = INIT_ALEATOIRE_CENTRE;
+            else if (strcmp(valeur, "clusters") == 0) type_init = INIT_ALEATOIRE_CLUSTERS;
+            else {
+                afficher_usage(argv[0]);
+                return 1;
+            }
+        } else if (strcmp(option, "--noyau") == 0) {
+            if (strcmp(valeur, "scalaire") == 0) {
+                selectionner_noyau_sse2(0);
+            } else if (strcmp(valeur, "sse2") != 0 || !selectionner_noyau_sse2(1)) {
+                fprintf(stderr, "noyau %s indisponible\n", valeur);
+                return 1;
+            }
+        } else if (strcmp(option, "--stockage") == 0) {
+            if (strcmp(valeur, "auto") == 0)       stockage = STOCKAGE_AUTOMATIQUE;
+            else if (strcmp(valeur, "dense") == 0) stockage = STOCKAGE_DENSE;
+            else {
+                afficher_usage(argv[0]);
+                return 1;
+            }
+        } else {
+            afficher_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (largeur <= 0 || hauteur <= 0 || iterations == 0) {
+        afficher_usage(argv[0]);
+        return 1;
+    }
+    if (nombre_graines == 0) {
+        nombre_graines = (int)(sizeof(GRAINES_PAR_DEFAUT) / sizeof(GRAINES_PAR_DEFAUT[0]));
+        memcpy(graines, GRAINES_PAR_DEFAUT, sizeof(GRAINES_PAR_DEFAUT));
+    }
+
+    size_t nombre_cellules = (size_t)largeur * (size_t)hauteur;
+    size_t taille_memoire = calculer_taille_memoire_automate(largeur, hauteur, MOTEUR_EVOLUTIF);
+    uint8_t *memoire_automate = calloc(1, taille_memoire);
+    InstantaneAutomate instantane = { .memoire = calloc(1, taille_memoire) };
+    static uint8_t memoire_affichage[80 * 25 * 2];  // Remplace la mémoire VGA
+    if (!memoire_automate || !instantane.memoire) {
+        fprintf(stderr, "allocation impossible pour %zu cellules\n", nombre_cellules);
+        return 1;
+    }
+
+    printf("graine,regles,largeur,hauteur,phase,iterations,population,densite_pct,"
+           "ns_total,ns_par_cellule,cellules_par_s\n");
+
+    for (int indice_graine = 0; indice_graine < nombre_graines; indice_graine++) {
+        AutomateCellulaire automate = {
+            .largeur_grille              = largeur,
+            .hauteur_grille              = hauteur,
+            .regles_format_texte         = regles,
+            .stockage                    = stockage,
+            .generation_actuelle         = 0,
+            .population_totale           = 0
+        };
+        attacher_memoire_automate(&automate, memoire_automate);
+        analyser_regles_automate(&automate);
+        initialiser_grille_selon_type(&automate, type_init, graines[indice_graine]);
+        for (uint32_t generation = 0; generation < prechauffage; generation++) {
+            calculer_generation_suivante(&automate);
+        }
+
+        // Population réelle de l'instantané (population_totale date du dernier calcul)
+        uint32_t population = 0;
+        for (size_t position = 0; position < nombre_cellules; position++) {
+            population += automate.etat_actuel.vivante[position];
+        }
+        sauvegarder_instantane(&automate, memoire_automate, &instantane, taille_memoire);
+
+        for (int phase = 0; phase < NOMBRE_PHASES; phase++) {
+            uint64_t total_ns = 0;
+            for (uint32_t iteration = 0; iteration < iterations; iteration++) {
+                restaurer_instantane(&automate, memoire_automate, &instantane, taille_memoire);
+                total_ns += mesurer_phase((PhaseMesuree)phase, &automate, memoire_affichage);
+            }
+
+            double ns_par_cellule = (double)total_ns / ((double)iterations * (double)nombre_cellules);
+            double cellules_par_s = (ns_par_cellule > 0.0) ? 1e9 / ns_par_cellule : 0.0;
+            printf("0x%08X,%s,%d,%d,%s,%u,%u,%.2f,%llu,%.3f,%.0f\n",
+                   graines[indice_graine], regles, largeur, hauteur, NOMS_PHASES[phase],
+                   iterations, population, 100.0 * population / (double)nombre_cellules,
+                   (unsigned long long)total_ns, ns_par_cellule, cellules_par_s);
+        }
+    }
+
+    free(memoire_automate);
+    free(instantane.memoire);
+    return 0;
+}
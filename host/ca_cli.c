@@ -0,0 +1,226 @@
+/**
+ * Headless hosted runner for the cellular automaton core
+ *
+ * Links the very same ca.c as the bare-metal kernel (built as libca.a)
+ * and runs calculer_generation_suivante at full native speed, without
+ * VGA output nor VITESSE_SIMULATION delay.
+ *
+ * Usage : ca_cli [--largeur N] [--hauteur N] [--graine X] [--regles B3/S23]
+ *                [--generations N] [--init uniforme|centre|clusters]
+ *                [--moteur evolutif|bitboard|hashlife] [--bord torique|fixe]
+ *                [--stockage auto|dense] [--profondeur N]
+ *
+ * --profondeur N (1 to PROFONDEUR_TEMPORELLE_MAX) advances each band of rows N
+ * generations per pass over the grid (see avancer_generations); the evolutionary
+ * engine then prints no tile statistics, its scratch grids not reporting them.
+ *
+ * With --moteur hashlife the initial grid is built by the bitboard engine,
+ * then loaded into an unbounded HashLife plane (B/S rules only) and advanced
+ * by powers of two, so --generations may go up to 4294967295.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ca.h"
+
+static void afficher_usage(const char *programme) {
+    fprintf(stderr,
+            "usage: %s [--largeur N] [--hauteur N] [--graine X] [--regles B3/S23]\n"
+            "          [--generations N] [--init uniforme|centre|clusters]\n"
+            "          [--moteur evolutif|bitboard|hashlife] [--bord torique|fixe]\n"
+            "          [--stockage auto|dense] [--profondeur N]\n",
+            programme);
+}
+
+// Arène de noeuds HashLife (le kernel utilise TAILLE_MEMOIRE_HASHLIFE_NOYAU)
+#define TAILLE_MEMOIRE_HASHLIFE_CLI (512u * 1024u * 1024u)
+
+static double secondes_monotones(void) {
+    struct timespec instant;
+    clock_gettime(CLOCK_MONOTONIC, &instant);
+    return (double)instant.tv_sec + (double)instant.tv_nsec * 1e-9;
+}
+
+// Même grille initiale, puis saut de nombre_generations sur le plan non borné
+static int executer_hashlife(const AutomateCellulaire *automate, uint32_t graine, uint32_t nombre_generations) {
+    UniversHashLife univers;
+    uint8_t *memoire_hashlife = malloc(TAILLE_MEMOIRE_HASHLIFE_CLI);
+    if (!memoire_hashlife || !attacher_memoire_hashlife(&univers, memoire_hashlife, TAILLE_MEMOIRE_HASHLIFE_CLI)) {
+        fprintf(stderr, "allocation impossible pour l'arene HashLife\n");
+        free(memoire_hashlife);
+        return 1;
+    }
+    if (!charger_hashlife(&univers, automate)) {
+        fprintf(stderr, "regles %s non supportees par HashLife (B0)\n", automate->regles_format_texte);
+        free(memoire_hashlife);
+        return 1;
+    }
+
+    double debut = secondes_monotones();
+    int succes = avancer_hashlife_generations(&univers, nombre_generations);
+    double duree = secondes_monotones() - debut;
+
+    printf("grille=%dx%d regles=%s graine=0x%08X generations=%u moteur=hashlife\n",
+           automate->largeur_grille, automate->hauteur_grille, automate->regles_format_texte,
+           graine, nombre_generations);
+    printf("temps_s=%.6f\n", duree);
+    printf("generations_par_s=%.1f\n", (duree > 0.0) ? nombre_generations / duree : 0.0);
+    printf("noeuds=%u/%u niveau_racine=%u\n", univers.nombre_noeuds, univers.capacite_noeuds,
+           univers.noeuds[univers.racine].niveau);
+    printf("population_finale=%llu\n", (unsigned long long)population_hashlife(&univers));
+
+    free(memoire_hashlife);
+    if (!succes) {
+        fprintf(stderr, "arene HashLife saturee a la generation %llu\n", (unsigned long long)univers.generation);
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    // Valeurs par défaut identiques au kernel
+    int largeur = 160;
+    int hauteur = 50;
+    uint32_t graine = 0x94215687;
+    const char *regles = REGLES_AUTOMATE;
+    uint32_t nombre_generations = 1000;
+    TypeInitialisation type_init = INIT_ALEATOIRE_CLUSTERS;
+    MoteurAutomate moteur = MOTEUR_EVOLUTIF;
+    int hashlife = 0;
+    BordAutomate bord = BORD_TORIQUE;
+    StockageAutomate stockage = STOCKAGE_AUTOMATIQUE;
+    uint32_t profondeur = 1;
+
+    // Lecture des options "--nom valeur"
+    for (int i = 1; i < argc; i++) {
+        const char *option = argv[i];
+        if (i + 1 >= argc) {
+            afficher_usage(argv[0]);
+            return 1;
+        }
+        const char *valeur = argv[++i];
+
+        if (strcmp(option, "--largeur") == 0) {
+            largeur = (int)strtol(valeur, NULL, 0);
+        } else if (strcmp(option, "--hauteur") == 0) {
+            hauteur = (int)strtol(valeur, NULL, 0);
+        } else if (strcmp(option, "--graine") == 0) {
+            graine = (uint32_t)strtoul(valeur, NULL, 0);
+        } else if (strcmp(option, "--regles") == 0) {
+            regles = valeur;
+        } else if (strcmp(option, "--generations") == 0) {
+            nombre_generations = (uint32_t)strtoul(valeur, NULL, 0);
+        } else if (strcmp(option, "--init") == 0) {
+            if (strcmp(valeur, "uniforme") == 0)      type_init = INIT_ALEATOIRE_UNIFORME;
+            else if (strcmp(valeur, "centre") == 0)   type_init = INIT_ALEATOIRE_CENTRE;
+            else if (strcmp(valeur, "clusters") == 0) type_init = INIT_ALEATOIRE_CLUSTERS;
+            else {
+                afficher_usage(argv[0]);
+                return 1;
+            }
+        } else if (strcmp(option, "--moteur") == 0) {
+            if (strcmp(valeur, "evolutif") == 0)      moteur = MOTEUR_EVOLUTIF;
+            else if (strcmp(valeur, "bitboard") == 0) moteur = MOTEUR_BITBOARD;
+            else if (strcmp(valeur, "hashlife") == 0) moteur = MOTEUR_BITBOARD, hashlife = 1;
+            else {
+                afficher_usage(argv[0]);
+                return 1;
+            }
+        } else if (strcmp(option, "--bord") == 0) {
+            if (strcmp(valeur, "torique") == 0)   bord = BORD_TORIQUE;
+            else if (strcmp(valeur, "fixe") == 0) bord = BORD_FIXE;
+            else {
+                afficher_usage(argv[0]);
+                return 1;
+            }
+        } else if (strcmp(option, "--profondeur") == 0) {
+            profondeur = (uint32_t)strtoul(valeur, NULL, 0);
+            if (profondeur == 0 || profondeur > PROFONDEUR_TEMPORELLE_MAX) {
+                afficher_usage(argv[0]);
+                return 1;
+            }
+        } else if (strcmp(option, "--stockage") == 0) {
+            if (strcmp(valeur, "auto") == 0)       stockage = STOCKAGE_AUTOMATIQUE;
+            else if (strcmp(valeur, "dense") == 0) stockage = STOCKAGE_DENSE;
+            else {
+                afficher_usage(argv[0]);
+                return 1;
+            }
+        } else {
+            afficher_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (largeur <= 0 || hauteur <= 0) {
+        fprintf(stderr, "taille de grille invalide: %dx%d\n", largeur, hauteur);
+        return 1;
+    }
+
+    AutomateCellulaire automate = {
+        .largeur_grille              = largeur,
+        .hauteur_grille              = hauteur,
+        .regles_format_texte         = regles,
+        .moteur                      = moteur,
+        .bord                        = bord,
+        .stockage                    = stockage,
+        .generation_actuelle         = 0,
+        .population_totale           = 0
+    };
+
+    // Un seul bloc mémoire pour toute la grille (le kernel utilise un tableau statique)
+    size_t nombre_cellules = (size_t)largeur * (size_t)hauteur;
+    uint8_t *memoire_automate = calloc(1, calculer_taille_memoire_automate(largeur, hauteur, moteur));
+    if (!memoire_automate) {
+        fprintf(stderr, "allocation impossible pour %zu cellules\n", nombre_cellules);
+        return 1;
+    }
+    attacher_memoire_automate(&automate, memoire_automate);
+
+    analyser_regles_automate(&automate);
+    initialiser_grille_selon_type(&automate, type_init, graine);
+
+    if (hashlife) {
+        int code = executer_hashlife(&automate, graine, nombre_generations);
+        free(memoire_automate);
+        return code;
+    }
+
+    // Tuiles calculées / dont l'environnement a été mis à jour et générations
+    // clairsemées, cumulées sur la course
+    uint64_t tuiles_calculees = 0, tuiles_environnement = 0;
+    uint32_t generations_clairsemees = 0;
+    double debut = secondes_monotones();
+    if (moteur == MOTEUR_BITBOARD || profondeur > 1) {
+        avancer_generations(&automate, nombre_generations, profondeur);
+    } else {
+        for (uint32_t generation = 0; generation < nombre_generations; generation++) {
+            calculer_generation_suivante(&automate);
+            tuiles_calculees += automate.tuiles_calculees;
+            tuiles_environnement += automate.tuiles_environnement;
+            generations_clairsemees += automate.generation_clairsemee;
+        }
+    }
+    double duree = secondes_monotones() - debut;
+
+    double generations_par_seconde = (duree > 0.0) ? nombre_generations / duree : 0.0;
+    printf("grille=%dx%d regles=%s graine=0x%08X generations=%u moteur=%s bord=%s\n",
+           largeur, hauteur, regles, graine, nombre_generations,
+           (moteur == MOTEUR_BITBOARD) ? "bitboard" : "evolutif",
+           (bord == BORD_FIXE) ? "fixe" : "torique");
+    printf("temps_s=%.6f\n", duree);
+    printf("generations_par_s=%.1f\n", generations_par_seconde);
+    printf("cellules_par_s=%.0f\n", generations_par_seconde * (double)nombre_cellules);
+    printf("population_finale=%u\n", automate.population_totale);
+    if (moteur == MOTEUR_EVOLUTIF && profondeur == 1 && nombre_generations > 0) {
+        double tuiles_total = (double)NOMBRE_TUILES(largeur, hauteur) * nombre_generations;
+        printf("tuiles_calculees_pct=%.1f\n", 100.0 * (double)tuiles_calculees / tuiles_total);
+        printf("tuiles_environnement_pct=%.1f\n", 100.0 * (double)tuiles_environnement / tuiles_total);
+        printf("generations_clairsemees_pct=%.1f\n", 100.0 * generations_clairsemees / nombre_generations);
+    }
+
+    free(memoire_automate);
+    return 0;
+}
@@ -0,0 +1,880 @@
+/**
+ * Reference-vs-optimized equivalence harness
+ *
+ * Runs the frozen reference kernel (ca_reference.c) next to every candidate
+ * kernel of the library, on a fixed set of rules, seeds and grid sizes, and
+ * compares the 64-bit state fingerprint after every generation. On the first
+ * mismatch the states are compared cell by cell to report the diverging
+ * generation, cell and field.
+ *
+ * The reference trajectory is also checked against the golden files stored in
+ * host/golden, so that a change of compiler or flags that alters the reference
+ * itself is caught as well.
+ *
+ * The pure B/S engine (MOTEUR_BITBOARD) is checked cell by cell against a
+ * naive byte-grid implementation of the rules, with no golden file, on a
+ * torus and with fixed boundaries. Its temporal blocking (avancer_generations)
+ * is then checked against the one-generation-at-a-time engine, and so is its
+ * generation shared in parts (calculer_etape_generation).
+ *
+ * The temporal blocking of the evolutionary engine (avancer_generations on
+ * grids with scratch grids) is checked against calculer_generation_suivante,
+ * on random grids and on movement claims across the seam of the torus.
+ *
+ * The HashLife engine runs on an unbounded plane: a random soup is loaded into
+ * it and into a bitboard torus (checked above) large enough that the light
+ * cone of the soup never wraps around, and both are compared at checkpoints
+ * after steps of 2^k generations.
+ *
+ * Usage : ca_equivalence --verifier DIR [--generations N]
+ *         ca_equivalence --generer DIR  [--generations N]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ca.h"
+#include "ca_reference.h"
+
+#define GENERATIONS_PAR_DEFAUT 256
+
+// Noyau candidat : calcule une génération sur l'automate de la bibliothèque
+typedef void (*NoyauGeneration)(AutomateCellulaire *automate);
+
+typedef struct {
+    const char *nom;
+    NoyauGeneration calculer;
+} NoyauCandidat;
+
+// Même génération, noyaux scalaires ou SSE2 imposés (sans SSE2, les deux sont scalaires)
+static void calculer_generation_scalaire(AutomateCellulaire *automate) {
+    selectionner_noyau_sse2(0);
+    calculer_generation_suivante(automate);
+}
+
+static void calculer_generation_sse2(AutomateCellulaire *automate) {
+    selectionner_noyau_sse2(1);
+    calculer_generation_suivante(automate);
+}
+
+// Stockage dense imposé : les deux autres passent aux listes quand la population s'effondre
+static void calculer_generation_dense(AutomateCellulaire *automate) {
+    selectionner_noyau_sse2(1);
+    automate->stockage = STOCKAGE_DENSE;
+    calculer_generation_suivante(automate);
+}
+
+// Génération partagée en parts calculées en ordre inverse à chaque étape, comme par des
+// processeurs quelconques (des plages de lignes coupées au milieu des tuiles et des blocs de lignes)
+#define PARTS_GENERATION_PARTAGEE 7
+
+static void calculer_etapes_en_parts(AutomateCellulaire *automate, uint32_t nombre_parts) {
+    BilanPartGeneration bilans[PARTS_GENERATION_PARTAGEE];
+    uint32_t nombre_etapes = debuter_generation_partagee(automate);
+    for (uint32_t etape = 0; etape < nombre_etapes; etape++) {
+        for (uint32_t part = nombre_parts; part-- > 0; ) {
+            calculer_etape_generation(automate, etape, part, nombre_parts, bilans);
+        }
+    }
+    terminer_generation_partagee(automate, bilans, nombre_parts);
+}
+
+static void calculer_generation_partagee(AutomateCellulaire *automate) {
+    selectionner_noyau_sse2(1);
+    calculer_etapes_en_parts(automate, PARTS_GENERATION_PARTAGEE);
+}
+
+static const NoyauCandidat NOYAUX_CANDIDATS[] = {
+    { "calculer_generation_suivante (scalaire)", calculer_generation_scalaire },
+    { "calculer_generation_suivante (sse2)", calculer_generation_sse2 },
+    { "calculer_generation_suivante (stockage dense)", calculer_generation_dense },
+    { "generation partagee (7 parts, ordre inverse)", calculer_generation_partagee },
+};
+#define NOMBRE_NOYAUX ((int)(sizeof(NOYAUX_CANDIDATS) / sizeof(NOYAUX_CANDIDATS[0])))
+
+// Cas figés : règles, graine et taille de grille
+typedef struct {
+    const char *regles;
+    uint32_t graine;
+    int largeur;
+    int hauteur;
+} CasEquivalence;
+
+static const CasEquivalence CAS_EQUIVALENCE[] = {
+    { "B3/S23",  0x94215687, 160, 50 },
+    { "B3/S23",  0x00C0FFEE, 160, 50 },
+    { "B3/S23",  0x12345678, 160, 50 },
+    { "B3/S23",  0x94215687,  97, 61 },
+    { "B36/S23", 0x94215687, 160, 50 },
+    { "B36/S23", 0x00C0FFEE, 160, 50 },
+    { "B36/S23", 0x12345678, 160, 50 },
+    { "B36/S23", 0x94215687,  97, 61 },
+    { "B34/S34", 0x94215687, 160, 50 },
+    { "B34/S34", 0x00C0FFEE, 160, 50 },
+    { "B34/S34", 0x12345678, 160, 50 },
+    { "B34/S34", 0x94215687,  97, 61 },
+};
+#define NOMBRE_CAS ((int)(sizeof(CAS_EQUIVALENCE) / sizeof(CAS_EQUIVALENCE[0])))
+
+// Cas du moteur bitboard : largeurs autour des frontières de mots de 32 bits
+static const CasEquivalence CAS_REGLES_PURES[] = {
+    { "B3/S23",      0x94215687, 160,  50 },
+    { "B36/S23",     0x00C0FFEE,  97,  61 },
+    { "B34/S34",     0x12345678,  33,  40 },
+    { "B2/S",        0x94215687,  32,  32 },
+    { "B1357/S1357", 0x00C0FFEE,  31,   7 },
+    { "B0/S8",       0x12345678,  65,   3 },
+};
+#define NOMBRE_CAS_REGLES_PURES ((int)(sizeof(CAS_REGLES_PURES) / sizeof(CAS_REGLES_PURES[0])))
+
+// Cas du blocage temporel : plusieurs bandes de LIGNES_BANDE_TEMPORELLE lignes, une
+// dernière bande incomplète, et des grilles moins hautes que le halo
+static const CasEquivalence CAS_BLOCAGE_TEMPOREL[] = {
+    { "B3/S23",  0x94215687, 100, 150 },
+    { "B36/S23", 0x00C0FFEE,  33, 200 },
+    { "B2/S",    0x12345678,  64, 129 },
+    { "B3/S23",  0x00C0FFEE,  40,   5 },
+    { "B0/S8",   0x94215687,  31,  70 },
+};
+#define NOMBRE_CAS_BLOCAGE_TEMPOREL ((int)(sizeof(CAS_BLOCAGE_TEMPOREL) / sizeof(CAS_BLOCAGE_TEMPOREL[0])))
+
+// Cas du blocage temporel du moteur évolutif : plusieurs bandes de LIGNES_BANDE_EVOLUTIVE
+// lignes, une dernière bande incomplète (plus basse que le halo), une largeur hors des mots
+static const CasEquivalence CAS_BLOCAGE_EVOLUTIF[] = {
+    { "B3/S23",  0x94215687, 160, 150 },
+    { "B36/S23", 0x00C0FFEE,  97, 200 },
+    { "B34/S34", 0x12345678,  64, 131 },
+};
+#define NOMBRE_CAS_BLOCAGE_EVOLUTIF ((int)(sizeof(CAS_BLOCAGE_EVOLUTIF) / sizeof(CAS_BLOCAGE_EVOLUTIF[0])))
+
+// Cas des réservations à la jointure du tore (voir placer_paires_jointure) : sans
+// naissance, toute cellule peut survivre
+static const CasEquivalence CAS_JOINTURE = { "B/S012345678", 0x94215687, 96, 100 };
+
+// Cas HashLife : règles, graine, côté de la soupe initiale et taille de l'arène en noeuds
+// (la petite arène force des compactions pendant le calcul)
+typedef struct {
+    const char *regles;
+    uint32_t graine;
+    int cote_soupe;
+    uint32_t capacite_noeuds;
+} CasHashLife;
+
+static const CasHashLife CAS_HASHLIFE[] = {
+    { "B3/S23",  0x94215687, 48, 1u << 20 },
+    { "B36/S23", 0x00C0FFEE, 40, 1u << 20 },
+    { "B36/S23", 0x12345678, 40, 1u << 14 },
+};
+#define NOMBRE_CAS_HASHLIFE ((int)(sizeof(CAS_HASHLIFE) / sizeof(CAS_HASHLIFE[0])))
+
+// Automate de la bibliothèque avec son bloc mémoire
+typedef struct {
+    AutomateCellulaire automate;
+    uint8_t *memoire;
+} InstanceAutomate;
+
+typedef struct {
+    AutomateReference automate;
+    CelluleEvolutive *grille_principale;
+    CelluleEvolutive *grille_calcul;
+    EnvironnementLocal *environnement;
+} InstanceReference;
+
+static void nom_fichier_golden(char *tampon, size_t taille, const char *dossier, const CasEquivalence *cas) {
+    char regles[32];
+    int longueur = 0;
+    for (const char *caractere = cas->regles; *caractere && longueur < (int)sizeof(regles) - 1; caractere++) {
+        if (*caractere != '/') regles[longueur++] = *caractere;
+    }
+    regles[longueur] = '\0';
+    snprintf(tampon, taille, "%s/%s_%dx%d_%08X.txt", dossier, regles, cas->largeur, cas->hauteur, cas->graine);
+}
+
+static int creer_instance(InstanceAutomate *instance, const CasEquivalence *cas) {
+    instance->memoire = calloc(1, calculer_taille_memoire_automate(cas->largeur, cas->hauteur, MOTEUR_EVOLUTIF));
+    if (!instance->memoire) return 0;
+
+    AutomateCellulaire automate = {
+        .largeur_grille              = cas->largeur,
+        .hauteur_grille              = cas->hauteur,
+        .regles_format_texte         = cas->regles,
+        .generation_actuelle         = 0,
+        .population_totale           = 0
+    };
+    instance->automate = automate;
+    attacher_memoire_automate(&instance->automate, instance->memoire);
+    analyser_regles_automate(&instance->automate);
+    initialiser_grille_aleatoire(&instance->automate, cas->graine);
+    return 1;
+}
+
+static void detruire_instance(InstanceAutomate *instance) {
+    free(instance->memoire);
+}
+
+// La référence démarre d'une copie exacte de l'état initial de la bibliothèque
+static int creer_reference(InstanceReference *reference, const InstanceAutomate *source) {
+    const AutomateCellulaire *automate = &source->automate;
+    size_t nombre_cellules = (size_t)automate->largeur_grille * (size_t)automate->hauteur_grille;
+    reference->grille_principale = calloc(nombre_cellules, sizeof(CelluleEvolutive));
+    reference->grille_calcul = calloc(nombre_cellules, sizeof(CelluleEvolutive));
+    reference->environnement = calloc(nombre_cellules, sizeof(EnvironnementLocal));
+    if (!reference->grille_principale || !reference->grille_calcul || !reference->environnement) return 0;
+
+    for (size_t position = 0; position < nombre_cellules; position++) {
+        lire_cellule(automate, (int)position, &reference->grille_principale[position]);
+        lire_environnement(automate, (int)position, &reference->environnement[position]);
+    }
+
+    AutomateReference etat = {
+        .largeur_grille              = automate->largeur_grille,
+        .hauteur_grille              = automate->hauteur_grille,
+        .masque_conditions_naissance = automate->masque_conditions_naissance,
+        .masque_conditions_survie    = automate->masque_conditions_survie,
+        .grille_cellules_actuelles   = reference->grille_principale,
+        .grille_cellules_suivantes   = reference->grille_calcul,
+        .grille_environnement        = reference->environnement,
+        .graine_aleatoire            = automate->graine_aleatoire,
+        .generation_actuelle         = automate->generation_actuelle,
+        .population_totale           = automate->population_totale
+    };
+    reference->automate = etat;
+    return 1;
+}
+
+static void detruire_reference(InstanceReference *reference) {
+    free(reference->grille_principale);
+    free(reference->grille_calcul);
+    free(reference->environnement);
+}
+
+// Compare un champ et retient le premier écart trouvé
+#define COMPARER_CHAMP(attendu, obtenu, champ)                                        \
+    do {                                                                              \
+        if ((int)(attendu)->champ != (int)(obtenu)->champ) {                          \
+            *nom_champ = #champ;                                                      \
+            *valeur_attendue = (int)(attendu)->champ;                                 \
+            *valeur_obtenue = (int)(obtenu)->champ;                                   \
+            return 1;                                                                 \
+        }                                                                             \
+    } while (0)
+
+static int comparer_cellules(const CelluleEvolutive *attendue, const CelluleEvolutive *obtenue,
+                             const char **nom_champ, int *valeur_attendue, int *valeur_obtenue) {
+    COMPARER_CHAMP(attendue, obtenue, vivante);
+    if (!attendue->vivante) return 0;  // Mêmes règles que l'empreinte
+    COMPARER_CHAMP(attendue, obtenue, age);
+    COMPARER_CHAMP(attendue, obtenue, genotype_survie);
+    COMPARER_CHAMP(attendue, obtenue, genotype_naissance);
+    COMPARER_CHAMP(attendue, obtenue, sante);
+    COMPARER_CHAMP(attendue, obtenue, race);
+    COMPARER_CHAMP(attendue, obtenue, polarisation);
+    COMPARER_CHAMP(attendue, obtenue, force_polarisation);
+    COMPARER_CHAMP(attendue, obtenue, compteur_mouvement);
+    COMPARER_CHAMP(attendue, obtenue, fitness_reproductif);
+    COMPARER_CHAMP(attendue, obtenue, efficacite_energetique);
+    COMPARER_CHAMP(attendue, obtenue, espece_id);
+    COMPARER_CHAMP(attendue, obtenue, resistance_maladie);
+    COMPARER_CHAMP(attendue, obtenue, camouflage_predation);
+    COMPARER_CHAMP(attendue, obtenue, territorialite);
+    COMPARER_CHAMP(attendue, obtenue, adaptabilite_stress);
+    COMPARER_CHAMP(attendue, obtenue, generation_naissance);
+    return 0;
+}
+
+static int comparer_environnements(const EnvironnementLocal *attendu, const EnvironnementLocal *obtenu,
+                                   const char **nom_champ, int *valeur_attendue, int *valeur_obtenue) {
+    COMPARER_CHAMP(attendu, obtenu, nutriments);
+    COMPARER_CHAMP(attendu, obtenu, temperature);
+    COMPARER_CHAMP(attendu, obtenu, pression_predation);
+    COMPARER_CHAMP(attendu, obtenu, pathogenes_present);
+    COMPARER_CHAMP(attendu, obtenu, toxicite_locale);
+    COMPARER_CHAMP(attendu, obtenu, competition_territoriale);
+    return 0;
+}
+
+// Localise et affiche la première cellule divergente entre référence et candidat
+static void rapporter_divergence(const AutomateReference *reference, const AutomateCellulaire *automate) {
+    const char *nom_champ = "population_totale";
+    int valeur_attendue = (int)reference->population_totale;
+    int valeur_obtenue = (int)automate->population_totale;
+    int taille_totale = reference->largeur_grille * reference->hauteur_grille;
+
+    for (int position = 0; position < taille_totale; position++) {
+        int x = position % reference->largeur_grille;
+        int y = position / reference->largeur_grille;
+        CelluleEvolutive obtenue;
+        EnvironnementLocal environnement_obtenu;
+        lire_cellule(automate, position, &obtenue);
+        lire_environnement(automate, position, &environnement_obtenu);
+        if (comparer_cellules(&reference->grille_cellules_actuelles[position], &obtenue,
+                              &nom_champ, &valeur_attendue, &valeur_obtenue)) {
+            printf("    premiere cellule divergente: (%d,%d) cellule.%s reference=%d obtenu=%d\n",
+                   x, y, nom_champ, valeur_attendue, valeur_obtenue);
+            return;
+        }
+        if (comparer_environnements(&reference->grille_environnement[position], &environnement_obtenu,
+                                    &nom_champ, &valeur_attendue, &valeur_obtenue)) {
+            printf("    premiere cellule divergente: (%d,%d) environnement.%s reference=%d obtenu=%d\n",
+                   x, y, nom_champ, valeur_attendue, valeur_obtenue);
+            return;
+        }
+    }
+    printf("    aucune cellule divergente: %s reference=%d obtenu=%d\n",
+           nom_champ, valeur_attendue, valeur_obtenue);
+}
+
+// Écrit la trajectoire de référence d'un cas : "generation empreinte population"
+static int generer_golden(const char *dossier, const CasEquivalence *cas, uint32_t generations) {
+    char chemin[512];
+    InstanceAutomate source;
+    InstanceReference reference;
+    nom_fichier_golden(chemin, sizeof(chemin), dossier, cas);
+
+    if (!creer_instance(&source, cas) || !creer_reference(&reference, &source)) {
+        fprintf(stderr, "allocation impossible\n");
+        return 0;
+    }
+    FILE *fichier = fopen(chemin, "w");
+    if (!fichier) {
+        fprintf(stderr, "impossible d'ecrire %s\n", chemin);
+        return 0;
+    }
+
+    fprintf(fichier, "# regles=%s graine=0x%08X grille=%dx%d generations=%u\n",
+            cas->regles, cas->graine, cas->largeur, cas->hauteur, generations);
+    for (uint32_t generation = 0; generation <= generations; generation++) {
+        if (generation > 0) calculer_generation_reference(&reference.automate);
+        fprintf(fichier, "%u %016llx %u\n", reference.automate.generation_actuelle,
+                (unsigned long long)calculer_empreinte_reference(&reference.automate),
+                reference.automate.population_totale);
+    }
+    fclose(fichier);
+    printf("ecrit %s\n", chemin);
+
+    detruire_reference(&reference);
+    detruire_instance(&source);
+    return 1;
+}
+
+static int lire_golden(const char *chemin, uint64_t *empreintes, uint32_t generations) {
+    FILE *fichier = fopen(chemin, "r");
+    if (!fichier) return 0;
+
+    char ligne[256];
+    uint32_t lues = 0;
+    while (lues <= generations && fgets(ligne, sizeof(ligne), fichier)) {
+        unsigned generation;
+        unsigned long long empreinte;
+        if (ligne[0] == '#') continue;
+        if (sscanf(ligne, "%u %llx", &generation, &empreinte) != 2 || generation != lues) break;
+        empreintes[lues++] = empreinte;
+    }
+    fclose(fichier);
+    return lues == generations + 1;
+}
+
+// Fait tourner référence et candidats côte à côte ; retourne le nombre d'échecs
+static int verifier_cas(const char *dossier, const CasEquivalence *cas, uint32_t generations) {
+    char chemin[512];
+    int echecs = 0;
+    uint64_t *golden = calloc(generations + 1, sizeof(uint64_t));
+    nom_fichier_golden(chemin, sizeof(chemin), dossier, cas);
+
+    if (!golden || !lire_golden(chemin, golden, generations)) {
+        printf("ECHEC %s: fichier golden absent ou trop court\n", chemin);
+        free(golden);
+        return 1;
+    }
+
+    InstanceAutomate candidats[NOMBRE_NOYAUX];
+    int candidat_diverge[NOMBRE_NOYAUX];
+    InstanceReference reference;
+    for (int noyau = 0; noyau < NOMBRE_NOYAUX; noyau++) {
+        candidat_diverge[noyau] = 0;
+        if (!creer_instance(&candidats[noyau], cas)) {
+            fprintf(stderr, "allocation impossible\n");
+            exit(1);
+        }
+    }
+    if (!creer_reference(&reference, &candidats[0])) {
+        fprintf(stderr, "allocation impossible\n");
+        exit(1);
+    }
+
+    int reference_diverge = 0;
+    for (uint32_t generation = 0; generation <= generations; generation++) {
+        if (generation > 0) {
+            calculer_generation_reference(&reference.automate);
+            for (int noyau = 0; noyau < NOMBRE_NOYAUX; noyau++) {
+                if (!candidat_diverge[noyau]) NOYAUX_CANDIDATS[noyau].calculer(&candidats[noyau].automate);
+            }
+        }
+
+        uint64_t empreinte_reference = calculer_empreinte_reference(&reference.automate);
+        if (!reference_diverge && empreinte_reference != golden[generation]) {
+            printf("ECHEC %s: la reference s'ecarte du golden a la generation %u\n", chemin, generation);
+            reference_diverge = 1;
+            echecs++;
+        }
+
+        for (int noyau = 0; noyau < NOMBRE_NOYAUX; noyau++) {
+            if (candidat_diverge[noyau]) continue;
+            if (calculer_empreinte_etat(&candidats[noyau].automate) != empreinte_reference) {
+                printf("ECHEC %s: noyau %s diverge a la generation %u\n",
+                       chemin, NOYAUX_CANDIDATS[noyau].nom, generation);
+                rapporter_divergence(&reference.automate, &candidats[noyau].automate);
+                candidat_diverge[noyau] = 1;
+                echecs++;
+            }
+        }
+    }
+
+    if (echecs == 0) {
+        printf("ok   %s (%d noyau(x), %u generations, population finale %u)\n",
+               chemin, NOMBRE_NOYAUX, generations, reference.automate.population_totale);
+    }
+
+    detruire_reference(&reference);
+    for (int noyau = 0; noyau < NOMBRE_NOYAUX; noyau++) detruire_instance(&candidats[noyau]);
+    free(golden);
+    return echecs;
+}
+
+// Moteur bitboard contre les règles B/S appliquées cellule par cellule
+static int verifier_cas_regles_pures(const CasEquivalence *cas, BordAutomate bord, uint32_t generations) {
+    int largeur = cas->largeur, hauteur = cas->hauteur;
+    size_t nombre_cellules = (size_t)largeur * (size_t)hauteur;
+    AutomateCellulaire automate = {
+        .largeur_grille      = largeur,
+        .hauteur_grille      = hauteur,
+        .regles_format_texte = cas->regles,
+        .moteur              = MOTEUR_BITBOARD,
+        .bord                = bord
+    };
+    const char *nom_bord = (bord == BORD_FIXE) ? "fixe" : "torique";
+    uint8_t *memoire = calloc(1, calculer_taille_memoire_automate(largeur, hauteur, MOTEUR_BITBOARD));
+    uint8_t *actuelle = calloc(nombre_cellules, 1);
+    uint8_t *suivante = calloc(nombre_cellules, 1);
+    if (!memoire || !actuelle || !suivante) {
+        fprintf(stderr, "allocation impossible\n");
+        exit(1);
+    }
+    attacher_memoire_automate(&automate, memoire);
+    analyser_regles_automate(&automate);
+    initialiser_grille_aleatoire(&automate, cas->graine);
+
+    CelluleEvolutive cellule;
+    for (size_t position = 0; position < nombre_cellules; position++) {
+        lire_cellule(&automate, (int)position, &cellule);
+        actuelle[position] = cellule.vivante;
+    }
+
+    int echecs = 0;
+    uint32_t population = 0;
+    for (uint32_t generation = 1; generation <= generations && !echecs; generation++) {
+        population = calculer_generation_regles_reference(actuelle, suivante, largeur, hauteur,
+                                                          automate.masque_conditions_naissance,
+                                                          automate.masque_conditions_survie,
+                                                          bord == BORD_FIXE);
+        calculer_generation_suivante(&automate);
+        uint8_t *echange = actuelle;
+        actuelle = suivante;
+        suivante = echange;
+
+        for (size_t position = 0; position < nombre_cellules; position++) {
+            lire_cellule(&automate, (int)position, &cellule);
+            if (cellule.vivante != actuelle[position]) {
+                printf("ECHEC bitboard %s %dx%d bord %s: generation %u, cellule (%d,%d) reference=%d obtenu=%d\n",
+                       cas->regles, largeur, hauteur, nom_bord, generation,
+                       (int)(position % largeur), (int)(position / largeur),
+                       actuelle[position], cellule.vivante);
+                echecs = 1;
+                break;
+            }
+        }
+        if (!echecs && automate.population_totale != population) {
+            printf("ECHEC bitboard %s %dx%d bord %s: generation %u, population reference=%u obtenu=%u\n",
+                   cas->regles, largeur, hauteur, nom_bord, generation, population, automate.population_totale);
+            echecs = 1;
+        }
+    }
+
+    if (!echecs) {
+        printf("ok   bitboard %s %dx%d bord %s graine=0x%08X (%u generations, population finale %u)\n",
+               cas->regles, largeur, hauteur, nom_bord, cas->graine, generations, population);
+    }
+    free(memoire);
+    free(actuelle);
+    free(suivante);
+    return echecs;
+}
+
+// Automate bitboard alloué et initialisé (soupe aléatoire ou grille vide)
+static uint8_t *creer_automate_bitboard(AutomateCellulaire *automate, const char *regles, int largeur, int hauteur) {
+    AutomateCellulaire initial = {
+        .largeur_grille      = largeur,
+        .hauteur_grille      = hauteur,
+        .regles_format_texte = regles,
+        .moteur              = MOTEUR_BITBOARD
+    };
+    uint8_t *memoire = calloc(1, calculer_taille_memoire_automate(largeur, hauteur, MOTEUR_BITBOARD));
+    if (!memoire) {
+        fprintf(stderr, "allocation impossible\n");
+        exit(1);
+    }
+    *automate = initial;
+    attacher_memoire_automate(automate, memoire);
+    analyser_regles_automate(automate);
+    return memoire;
+}
+
+// Blocage temporel du moteur bitboard contre ses générations une à une (vérifiées
+// ci-dessus), avec des profondeurs de 2 à PROFONDEUR_TEMPORELLE_MAX tour à tour
+static int verifier_cas_blocage_temporel(const CasEquivalence *cas, BordAutomate bord, uint32_t generations) {
+    size_t nombre_cellules = (size_t)cas->largeur * (size_t)cas->hauteur;
+    const char *nom_bord = (bord == BORD_FIXE) ? "fixe" : "torique";
+    AutomateCellulaire une_a_une, par_bandes;
+    uint8_t *memoire_une_a_une = creer_automate_bitboard(&une_a_une, cas->regles, cas->largeur, cas->hauteur);
+    uint8_t *memoire_par_bandes = creer_automate_bitboard(&par_bandes, cas->regles, cas->largeur, cas->hauteur);
+    une_a_une.bord = bord;
+    par_bandes.bord = bord;
+    initialiser_grille_aleatoire(&une_a_une, cas->graine);
+    initialiser_grille_aleatoire(&par_bandes, cas->graine);
+    
+    int echecs = 0;
+    uint32_t profondeur = 2;
+    while (une_a_une.generation_actuelle < generations && !echecs) {
+        uint32_t restantes = generations - une_a_une.generation_actuelle;
+        uint32_t pas = (profondeur < restantes) ? profondeur : restantes;
+        for (uint32_t generation = 0; generation < pas; generation++) calculer_generation_suivante(&une_a_une);
+        avancer_generations(&par_bandes, pas, profondeur);
+        
+        CelluleEvolutive attendue, cellule;
+        for (size_t position = 0; position < nombre_cellules && !echecs; position++) {
+            lire_cellule(&une_a_une, (int)position, &attendue);
+            lire_cellule(&par_bandes, (int)position, &cellule);
+            if (cellule.vivante != attendue.vivante) {
+                printf("ECHEC blocage temporel %s %dx%d bord %s: generation %u (profondeur %u), "
+                       "cellule (%d,%d) reference=%d obtenu=%d\n",
+                       cas->regles, cas->largeur, cas->hauteur, nom_bord, une_a_une.generation_actuelle,
+                       profondeur, (int)(position % cas->largeur), (int)(position / cas->largeur),
+                       attendue.vivante, cellule.vivante);
+                echecs = 1;
+            }
+        }
+        if (!echecs && (par_bandes.population_totale != une_a_une.population_totale ||
+                        par_bandes.generation_actuelle != une_a_une.generation_actuelle)) {
+            printf("ECHEC blocage temporel %s %dx%d bord %s: generation %u, population reference=%u obtenu=%u\n",
+                   cas->regles, cas->largeur, cas->hauteur, nom_bord, une_a_une.generation_actuelle,
+                   une_a_une.population_totale, par_bandes.population_totale);
+            echecs = 1;
+        }
+        profondeur = (profondeur == PROFONDEUR_TEMPORELLE_MAX) ? 2 : profondeur + 1;
+    }
+    
+    if (!echecs) {
+        printf("ok   blocage temporel %s %dx%d bord %s graine=0x%08X (%u generations, population finale %u)\n",
+               cas->regles, cas->largeur, cas->hauteur, nom_bord, cas->graine, generations,
+               par_bandes.population_totale);
+    }
+    free(memoire_une_a_une);
+    free(memoire_par_bandes);
+    return echecs;
+}
+
+/**
+ * Only pairs of nomad cells aiming at the same empty site across the seam of the
+ * torus: rows hauteur - 1 (south) and 1 (north) aim at row 0, rows hauteur - 2
+ * (south) and 0 (north) at row hauteur - 1. When both move, the claim goes to the
+ * lower position of the whole grid, whatever the order of these rows in a scratch
+ * grid of the temporal blocking
+ */
+static void placer_paires_jointure(AutomateCellulaire *automate) {
+    int largeur = automate->largeur_grille, hauteur = automate->hauteur_grille;
+    CelluleEvolutive vide = {0}, nomade = {
+        .vivante = 1, .age = 10, .sante = 100, .race = RACE_NOMADE,
+        .genotype_survie = 128, .genotype_naissance = 128, .fitness_reproductif = 128,
+        .efficacite_energetique = 128, .resistance_maladie = 255, .camouflage_predation = 255
+    };
+    for (int position = 0; position < largeur * hauteur; position++) ecrire_cellule(automate, position, &vide);
+    
+    uint32_t population = 0;
+    for (int colonne = 0; colonne + 1 < largeur; colonne += 3) {
+        const int lignes[4] = { hauteur - 1, 1, hauteur - 2, 0 };
+        const int colonnes[4] = { colonne, colonne, colonne + 1, colonne + 1 };
+        const DirectionPolarisation directions[4] = { DIRECTION_SUD, DIRECTION_NORD, DIRECTION_SUD, DIRECTION_NORD };
+        for (int i = 0; i < 4; i++) {
+            nomade.polarisation = (uint8_t)directions[i];
+            ecrire_cellule(automate, lignes[i] * largeur + colonnes[i], &nomade);
+            population++;
+        }
+    }
+    automate->population_totale = population;
+}
+
+// Blocage temporel du moteur évolutif contre ses générations une à une (vérifiées contre
+// la référence ci-dessus), avec des profondeurs de 2 à PROFONDEUR_TEMPORELLE_MAX tour à tour :
+// les phases de mouvement tombent à toutes les places d'un bloc
+static int verifier_cas_blocage_evolutif(const CasEquivalence *cas, BordAutomate bord, uint32_t generations,
+                                         void (*preparer)(AutomateCellulaire *automate)) {
+    const char *nom_bord = (bord == BORD_FIXE) ? "fixe" : "torique";
+    InstanceAutomate une_a_une, par_bandes;
+    if (!creer_instance(&une_a_une, cas) || !creer_instance(&par_bandes, cas)) {
+        fprintf(stderr, "allocation impossible\n");
+        exit(1);
+    }
+    une_a_une.automate.bord = bord;
+    par_bandes.automate.bord = bord;
+    if (preparer) {
+        preparer(&une_a_une.automate);
+        preparer(&par_bandes.automate);
+    }
+    
+    int echecs = 0;
+    uint32_t profondeur = 2;
+    while (une_a_une.automate.generation_actuelle < generations && !echecs) {
+        uint32_t restantes = generations - une_a_une.automate.generation_actuelle;
+        uint32_t pas = (profondeur < restantes) ? profondeur : restantes;
+        for (uint32_t generation = 0; generation < pas; generation++) calculer_generation_suivante(&une_a_une.automate);
+        avancer_generations(&par_bandes.automate, pas, profondeur);
+        
+        if (calculer_empreinte_etat(&par_bandes.automate) != calculer_empreinte_etat(&une_a_une.automate)) {
+            const char *nom_champ = "population_totale";
+            int valeur_attendue = (int)une_a_une.automate.population_totale;
+            int valeur_obtenue = (int)par_bandes.automate.population_totale;
+            int position = 0, taille_totale = cas->largeur * cas->hauteur;
+            for (; position < taille_totale; position++) {
+                CelluleEvolutive attendue, cellule;
+                EnvironnementLocal environnement_attendu, environnement;
+                lire_cellule(&une_a_une.automate, position, &attendue);
+                lire_cellule(&par_bandes.automate, position, &cellule);
+                lire_environnement(&une_a_une.automate, position, &environnement_attendu);
+                lire_environnement(&par_bandes.automate, position, &environnement);
+                if (comparer_cellules(&attendue, &cellule, &nom_champ, &valeur_attendue, &valeur_obtenue) ||
+                    comparer_environnements(&environnement_attendu, &environnement, &nom_champ,
+                                            &valeur_attendue, &valeur_obtenue)) break;
+            }
+            printf("ECHEC blocage evolutif %s %dx%d bord %s: generation %u (profondeur %u), "
+                   "cellule (%d,%d) %s reference=%d obtenu=%d\n",
+                   cas->regles, cas->largeur, cas->hauteur, nom_bord, une_a_une.automate.generation_actuelle,
+                   profondeur, position % cas->largeur, position / cas->largeur, nom_champ,
+                   valeur_attendue, valeur_obtenue);
+            echecs = 1;
+        }
+        profondeur = (profondeur == PROFONDEUR_TEMPORELLE_MAX) ? 2 : profondeur + 1;
+    }
+    
+    if (!echecs) {
+        printf("ok   blocage evolutif %s %dx%d bord %s graine=0x%08X (%u generations, population finale %u)\n",
+               cas->regles, cas->largeur, cas->hauteur, nom_bord, cas->graine, generations,
+               par_bandes.automate.population_totale);
+    }
+    detruire_instance(&une_a_une);
+    detruire_instance(&par_bandes);
+    return echecs;
+}
+
+// Génération partagée du moteur bitboard contre ses générations une à une, de 1 à
+// PARTS_GENERATION_PARTAGEE parts tour à tour (des parts de moins d'une ligne pour les grilles basses)
+static int verifier_cas_generation_partagee(const CasEquivalence *cas, BordAutomate bord, uint32_t generations) {
+    size_t nombre_cellules = (size_t)cas->largeur * (size_t)cas->hauteur;
+    const char *nom_bord = (bord == BORD_FIXE) ? "fixe" : "torique";
+    AutomateCellulaire une_a_une, partagee;
+    uint8_t *memoire_une_a_une = creer_automate_bitboard(&une_a_une, cas->regles, cas->largeur, cas->hauteur);
+    uint8_t *memoire_partagee = creer_automate_bitboard(&partagee, cas->regles, cas->largeur, cas->hauteur);
+    une_a_une.bord = bord;
+    partagee.bord = bord;
+    initialiser_grille_aleatoire(&une_a_une, cas->graine);
+    initialiser_grille_aleatoire(&partagee, cas->graine);
+    
+    int echecs = 0;
+    for (uint32_t generation = 0; generation < generations && !echecs; generation++) {
+        uint32_t nombre_parts = 1 + generation % PARTS_GENERATION_PARTAGEE;
+        calculer_generation_suivante(&une_a_une);
+        calculer_etapes_en_parts(&partagee, nombre_parts);
+        
+        CelluleEvolutive attendue, cellule;
+        for (size_t position = 0; position < nombre_cellules && !echecs; position++) {
+            lire_cellule(&une_a_une, (int)position, &attendue);
+            lire_cellule(&partagee, (int)position, &cellule);
+            if (cellule.vivante != attendue.vivante) {
+                printf("ECHEC generation partagee %s %dx%d bord %s: generation %u (%u parts), "
+                       "cellule (%d,%d) reference=%d obtenu=%d\n",
+                       cas->regles, cas->largeur, cas->hauteur, nom_bord, une_a_une.generation_actuelle,
+                       nombre_parts, (int)(position % cas->largeur), (int)(position / cas->largeur),
+                       attendue.vivante, cellule.vivante);
+                echecs = 1;
+            }
+        }
+        if (!echecs && (partagee.population_totale != une_a_une.population_totale ||
+                        partagee.generation_actuelle != une_a_une.generation_actuelle)) {
+            printf("ECHEC generation partagee %s %dx%d bord %s: generation %u, population reference=%u obtenu=%u\n",
+                   cas->regles, cas->largeur, cas->hauteur, nom_bord, une_a_une.generation_actuelle,
+                   une_a_une.population_totale, partagee.population_totale);
+            echecs = 1;
+        }
+    }
+    
+    if (!echecs) {
+        printf("ok   generation partagee %s %dx%d bord %s graine=0x%08X (%u generations, population finale %u)\n",
+               cas->regles, cas->largeur, cas->hauteur, nom_bord, cas->graine, generations,
+               partagee.population_totale);
+    }
+    free(memoire_une_a_une);
+    free(memoire_partagee);
+    return echecs;
+}
+
+// HashLife contre le moteur bitboard sur un tore où le cône de lumière de la soupe ne boucle jamais
+static int verifier_cas_hashlife(const CasHashLife *cas, uint32_t generations) {
+    int cote = cas->cote_soupe + 2 * (int)generations + 2;
+    size_t nombre_cellules = (size_t)cote * (size_t)cote;
+    AutomateCellulaire soupe, tore, vue;
+    uint8_t *memoire_soupe = creer_automate_bitboard(&soupe, cas->regles, cas->cote_soupe, cas->cote_soupe);
+    uint8_t *memoire_tore = creer_automate_bitboard(&tore, cas->regles, cote, cote);
+    uint8_t *memoire_vue = creer_automate_bitboard(&vue, cas->regles, cote, cote);
+    uint32_t taille_arene = cas->capacite_noeuds * (uint32_t)OCTETS_PAR_NOEUD_HASHLIFE;
+    uint8_t *arene = malloc(taille_arene);
+    UniversHashLife univers;
+    if (!arene || !attacher_memoire_hashlife(&univers, arene, taille_arene)) {
+        fprintf(stderr, "allocation impossible\n");
+        exit(1);
+    }
+    initialiser_grille_aleatoire(&soupe, cas->graine);
+
+    // Le coin (-cote/2, -cote/2) du plan est la cellule (0,0) du tore
+    int decalage = cote / 2 - cas->cote_soupe / 2;
+    CelluleEvolutive cellule;
+    for (int ligne = 0; ligne < cas->cote_soupe; ligne++) {
+        for (int colonne = 0; colonne < cas->cote_soupe; colonne++) {
+            lire_cellule(&soupe, ligne * cas->cote_soupe + colonne, &cellule);
+            ecrire_cellule(&tore, (ligne + decalage) * cote + colonne + decalage, &cellule);
+        }
+    }
+
+    int echecs = !charger_hashlife(&univers, &soupe);
+    if (echecs) printf("ECHEC hashlife %s: chargement refuse\n", cas->regles);
+
+    // Points de contrôle après des pas de 1, 2, 4... générations, puis le reste un par un
+    uint32_t generation = 0;
+    for (uint32_t pas = 0; generation < generations && !echecs; pas++) {
+        uint32_t log2_pas = pas;
+        while (log2_pas > 0 && generation + (1u << log2_pas) > generations) log2_pas--;
+        if (!avancer_hashlife(&univers, log2_pas)) {
+            printf("ECHEC hashlife %s: arene saturee a la generation %u\n", cas->regles, generation);
+            echecs = 1;
+            break;
+        }
+        for (uint32_t etape = 0; etape < (1u << log2_pas); etape++) {
+            calculer_generation_suivante(&tore);
+        }
+        generation += 1u << log2_pas;
+
+        rasteriser_hashlife(&univers, -(int64_t)(cote / 2), -(int64_t)(cote / 2), &vue);
+        CelluleEvolutive attendue;
+        for (size_t position = 0; position < nombre_cellules && !echecs; position++) {
+            lire_cellule(&tore, (int)position, &attendue);
+            lire_cellule(&vue, (int)position, &cellule);
+            if (cellule.vivante != attendue.vivante) {
+                printf("ECHEC hashlife %s graine=0x%08X: generation %u, cellule (%d,%d) reference=%d obtenu=%d\n",
+                       cas->regles, cas->graine, generation, (int)(position % cote) - cote / 2,
+                       (int)(position / cote) - cote / 2, attendue.vivante, cellule.vivante);
+                echecs = 1;
+            }
+        }
+        uint32_t population = tore.population_totale;
+        if (!echecs && (population_hashlife(&univers) != population || vue.population_totale != population ||
+                        univers.generation != generation)) {
+            printf("ECHEC hashlife %s graine=0x%08X: generation %u, population reference=%u obtenu=%llu\n",
+                   cas->regles, cas->graine, generation, population,
+                   (unsigned long long)population_hashlife(&univers));
+            echecs = 1;
+        }
+    }
+
+    if (!echecs) {
+        printf("ok   hashlife %s soupe %dx%d graine=0x%08X arene=%u noeuds (%u generations, population finale %u)\n",
+               cas->regles, cas->cote_soupe, cas->cote_soupe, cas->graine, cas->capacite_noeuds,
+               generations, tore.population_totale);
+    }
+    free(memoire_soupe);
+    free(memoire_tore);
+    free(memoire_vue);
+    free(arene);
+    return echecs;
+}
+
+static void afficher_usage(const char *programme) {
+    fprintf(stderr,
+            "usage: %s --verifier DIR [--generations N]\n"
+            "       %s --generer DIR  [--generations N]\n",
+            programme, programme);
+}
+
+int main(int argc, char **argv) {
+    const char *dossier = NULL;
+    int mode_generation = 0;
+    uint32_t generations = GENERATIONS_PAR_DEFAUT;
+
+    for (int i = 1; i < argc; i++) {
+        const char *option = argv[i];
+        if (i + 1 >= argc) {
+            afficher_usage(argv[0]);
+            return 1;
+        }
+        const char *valeur = argv[++i];
+
+        if (strcmp(option, "--verifier") == 0) {
+            dossier = valeur;
+            mode_generation = 0;
+        } else if (strcmp(option, "--generer") == 0) {
+            dossier = valeur;
+            mode_generation = 1;
+        } else if (strcmp(option, "--generations") == 0) {
+            generations = (uint32_t)strtoul(valeur, NULL, 0);
+        } else {
+            afficher_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (!dossier) {
+        afficher_usage(argv[0]);
+        return 1;
+    }
+
+    int echecs = 0;
+    for (int cas = 0; cas < NOMBRE_CAS; cas++) {
+        if (mode_generation) {
+            if (!generer_golden(dossier, &CAS_EQUIVALENCE[cas], generations)) echecs++;
+        } else {
+            echecs += verifier_cas(dossier, &CAS_EQUIVALENCE[cas], generations);
+        }
+    }
+
+    if (!mode_generation) {
+        for (int cas = 0; cas < NOMBRE_CAS_REGLES_PURES; cas++) {
+            echecs += verifier_cas_regles_pures(&CAS_REGLES_PURES[cas], BORD_TORIQUE, generations);
+            echecs += verifier_cas_regles_pures(&CAS_REGLES_PURES[cas], BORD_FIXE, generations);
+        }
+        for (int cas = 0; cas < NOMBRE_CAS_BLOCAGE_TEMPOREL; cas++) {
+            echecs += verifier_cas_blocage_temporel(&CAS_BLOCAGE_TEMPOREL[cas], BORD_TORIQUE, generations);
+            echecs += verifier_cas_blocage_temporel(&CAS_BLOCAGE_TEMPOREL[cas], BORD_FIXE, generations);
+            echecs += verifier_cas_generation_partagee(&CAS_BLOCAGE_TEMPOREL[cas], BORD_TORIQUE, generations);
+            echecs += verifier_cas_generation_partagee(&CAS_BLOCAGE_TEMPOREL[cas], BORD_FIXE, generations);
+        }
+        for (int cas = 0; cas < NOMBRE_CAS_BLOCAGE_EVOLUTIF; cas++) {
+            echecs += verifier_cas_blocage_evolutif(&CAS_BLOCAGE_EVOLUTIF[cas], BORD_TORIQUE, generations, NULL);
+            echecs += verifier_cas_blocage_evolutif(&CAS_BLOCAGE_EVOLUTIF[cas], BORD_FIXE, generations, NULL);
+        }
+        echecs += verifier_cas_blocage_evolutif(&CAS_JOINTURE, BORD_TORIQUE, generations, placer_paires_jointure);
+        echecs += verifier_cas_blocage_evolutif(&CAS_JOINTURE, BORD_FIXE, generations, placer_paires_jointure);
+        for (int cas = 0; cas < NOMBRE_CAS_HASHLIFE; cas++) {
+            echecs += verifier_cas_hashlife(&CAS_HASHLIFE[cas], generations);
+        }
+        printf("%s: %d echec(s) sur %d cas\n", echecs ? "ECHEC" : "OK", echecs,
+               NOMBRE_CAS + 2 * NOMBRE_CAS_REGLES_PURES + 4 * NOMBRE_CAS_BLOCAGE_TEMPOREL +
+               2 * NOMBRE_CAS_BLOCAGE_EVOLUTIF + 2 + NOMBRE_CAS_HASHLIFE);
+    }
+    return echecs ? 1 : 0;
+}
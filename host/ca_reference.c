@@ -0,0 +1,897 @@
+/**
+ * Frozen reference kernel for equivalence checking
+ *
+ * Started as a verbatim copy of calculer_generation_suivante (and the static
+ * helpers it uses) as it stood before any optimization work. It runs on its own
+ * plain array-of-structs state so that optimized engines in ca.c can be compared
+ * to it generation by generation. Do not optimize this file: it only changes when
+ * the simulation semantics are changed on purpose, together with the golden files
+ * (fixed point, transition table first, counter-based draws, movement from the
+ * pre-move grid so far, see README).
+ * The fixed-point core is mirrored here with plain divisions and modulo-free
+ * draws, so the reciprocal tables of ca.c are checked against real quotients.
+ */
+#include "ca_reference.h"
+
+// Quart d'onde sinusoïdale en Q8 : sin(i * pi / 128) * 256, i = 0..64
+static const uint16_t QUART_SINUS_Q8[65] = {
+      0,   6,  13,  19,  25,  31,  38,  44,  50,  56,  62,  68,  74,
+     80,  86,  92,  98, 104, 109, 115, 121, 126, 132, 137, 142, 147,
+    152, 157, 162, 167, 172, 177, 181, 185, 190, 194, 198, 202, 206,
+    209, 213, 216, 220, 223, 226, 229, 231, 234, 237, 239, 241, 243,
+    245, 247, 248, 250, 251, 252, 253, 254, 255, 255, 256, 256, 256,
+};
+
+// Sinus en Q8 (-256..256) d'une phase exprimée en 256e de tour
+static int sinus_q8(uint32_t phase) {
+    uint32_t indice = phase & 63u;
+    int valeur = (phase & 64u) ? QUART_SINUS_Q8[64 - indice] : QUART_SINUS_Q8[indice];
+    return (phase & 128u) ? -valeur : valeur;
+}
+
+static int abs_entier(int x) {
+    return (x < 0) ? -x : x;
+}
+
+// Phase (256e de tour) de la génération dans un cycle de "periode" générations
+#define PHASE_CYCLE(generation, periode) ((((generation) % (periode)) * 256u) / (periode))
+
+// Tirage uniforme dans [0, n) sur 16 bits du générateur : haut du mot, bits 8..23, bas du mot
+#define TIRAGE_PRINCIPAL(generateur, n)  ((((generateur) >> 16) * (n)) >> 16)
+#define TIRAGE_SECONDAIRE(generateur, n) (((((generateur) >> 8) & 0xFFFFu) * (n)) >> 16)
+#define TIRAGE_TERTIAIRE(generateur, n)  ((((generateur) & 0xFFFFu) * (n)) >> 16)
+
+// Tirages à compteur : le mot de l'emplacement k d'une cellule ne dépend que de
+// (graine, génération, cellule, k), via une bijection du compteur indexée par la clé
+static uint32_t melanger_32(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x7FEB352Du;
+    x ^= x >> 15;
+    x *= 0x846CA68Bu;
+    x ^= x >> 16;
+    return x;
+}
+
+static uint32_t cle_tirages;       // Clé de la génération en cours
+static uint32_t compteur_tirages;  // cellule x EMPLACEMENTS_PAR_CELLULE + prochain emplacement
+
+static void ouvrir_tirages(int position, uint32_t premier_emplacement) {
+    compteur_tirages = (uint32_t)position * EMPLACEMENTS_PAR_CELLULE + premier_emplacement;
+}
+
+static uint32_t tirer(void) {
+    return melanger_32(compteur_tirages++ * 0x9E3779B9u + cle_tirages);
+}
+
+// Déclarations forward pour éviter les erreurs de compilation
+static uint32_t calculer_fertilite(uint8_t age);
+static uint8_t determiner_espece(CelluleEvolutive* parents[], int nombre_parents, 
+                                int position_x, int position_y, int largeur, int hauteur);
+
+/**
+ * Calculates predation pressure for a given generation and position
+ * Implements realistic predator-prey cycles
+ */
+static uint8_t calculer_pression_predation(uint32_t generation, int x, int y, int largeur, int hauteur) {
+    int intensite_base = Q8(0.5) + sinus_q8(PHASE_CYCLE(generation, PREDATION_CYCLE)) / 2;
+    
+    // Predation gradient: higher at edges (predators hunt from outside)
+    int demi_largeur = (largeur / 2 > 0) ? largeur / 2 : 1;
+    int demi_hauteur = (hauteur / 2 > 0) ? hauteur / 2 : 1;
+    int distance_bord_x = ((x < largeur/2) ? x * 256 : (largeur-x) * 256) / demi_largeur;
+    int distance_bord_y = ((y < hauteur/2) ? y * 256 : (hauteur-y) * 256) / demi_hauteur;
+    int distance_centre = 256 - (distance_bord_x + distance_bord_y) / 2;
+    int gradient = Q8(0.3) + Q8(0.7) * distance_centre / 256;
+    if (gradient < 0) gradient = 0;
+    
+    uint32_t pression_finale = ((uint32_t)intensite_base * (uint32_t)gradient * PREDATION_PRESSURE) >> 16;
+    return (pression_finale > 255) ? 255 : (uint8_t)pression_finale;
+}
+
+/**
+ * Calculates epidemic disease presence based on population density
+ * Realistic disease spread modeling
+ */
+static uint8_t calculer_pathogenes(uint32_t generation, int densite_locale) {
+    uint32_t intensite_epidemie = (uint32_t)abs_entier(sinus_q8(PHASE_CYCLE(generation, EPIDEMIC_CYCLE)));
+    
+    // Disease spreads faster in dense populations (realistic epidemiology)
+    uint32_t facteur_densite = (densite_locale > 4) ? Q8(1.5) : Q8(0.8);
+    
+    uint32_t pathogenes = (intensite_epidemie * facteur_densite * EPIDEMIC_MORTALITY) >> 16;
+    return (pathogenes > 255) ? 255 : (uint8_t)pathogenes;
+}
+
+/**
+ * Calculates food scarcity based on environmental cycles
+ * Implements seasonal resource availability patterns
+ */
+static uint32_t calculer_disponibilite_nourriture(uint32_t generation) {
+    uint32_t phase_nourriture = PHASE_CYCLE(generation, FOOD_SCARCITY_CYCLE);
+    return (uint32_t)(Q8(0.6) + Q8(0.4) * sinus_q8(phase_nourriture + 64) / 256);  // Shifted sine for seasons
+}
+
+// =============================
+// FONCTIONS ÉVOLUTIVES BIOLOGIQUES
+// =============================
+
+// Calcule le fitness reproductif selon la théorie de l'évolution adaptative
+static uint8_t calculer_fitness_evolutif(CelluleEvolutive* cellule, int position_x, int position_y, 
+                                        uint32_t generation, int largeur, int hauteur) {
+    // Fitness de base selon l'âge optimal (courbe en cloche)
+    uint32_t fitness_age = calculer_fertilite(cellule->age);
+    
+    // Cycle énergétique sinusoïdal créant une pression de sélection variable
+    uint32_t phase_environnementale = PHASE_CYCLE(generation, CYCLES_ENVIRONNEMENTAUX);
+    uint32_t coefficient_energetique = (uint32_t)(256 + Q8(0.3) * sinus_q8(phase_environnementale) / 256);
+    
+    // Fitness spatial : avantage selon la position (niches écologiques)
+    int distance_centre_x = 2 * 256 * position_x / largeur - 256;  // -1 à 1
+    int distance_centre_y = 2 * 256 * position_y / hauteur - 256;  // -1 à 1
+    int distance_carree = (distance_centre_x * distance_centre_x + distance_centre_y * distance_centre_y) / 256;
+    uint32_t niche_factor = (uint32_t)(256 - Q8(0.3) * distance_carree / 256);
+    
+    // Fitness racial : spécialisations évolutives
+    uint32_t bonus_racial = 256;
+    switch (cellule->race) {
+        case RACE_EXPLORATRICE:
+            bonus_racial = 256 + Q8(0.2) * (256 - niche_factor) / 256;  // Avantage en périphérie
+            break;
+        case RACE_COLONISATRICE: 
+            bonus_racial = 256 + Q8(0.2) * niche_factor / 256;  // Avantage au centre
+            break;
+        case RACE_NOMADE:
+            bonus_racial = 256 + Q8(0.1) * coefficient_energetique / 256;  // Avantage lors de cycles favorables
+            break;
+        case RACE_ADAPTATIVE:
+            bonus_racial = (uint32_t)(256 + Q8(0.15) * abs_entier(sinus_q8(phase_environnementale * 2)) / 256);  // Avantage lors de changements
+            break;
+        case NOMBRE_RACES:
+        default:
+            bonus_racial = 256;
+            break;
+    }
+    
+    // Efficacité énergétique : utilisation optimale des ressources
+    uint32_t efficacite = cellule->efficacite_energetique;
+    uint32_t bonus_efficacite = 256 + efficacite * coefficient_energetique / 1024;
+    
+    // Calcul final du fitness (0-255)
+    uint32_t fitness_total = FITNESS_AMPLITUDE * fitness_age;
+    fitness_total = fitness_total * coefficient_energetique / 256;
+    fitness_total = fitness_total * niche_factor / 256;
+    fitness_total = fitness_total * bonus_racial / 256;
+    fitness_total = fitness_total * bonus_efficacite / 65536;
+    
+    return (fitness_total > 255) ? 255 : (uint8_t)fitness_total;
+}
+
+// Calcule la distance génétique entre deux cellules pour la spéciation (réservé pour extensions futures)
+/*
+static uint8_t calculer_distance_genetique(CelluleEvolutive* cellule1, CelluleEvolutive* cellule2) {
+    int diff_survie = int_abs((int)cellule1->genotype_survie - (int)cellule2->genotype_survie);
+    int diff_naissance = int_abs((int)cellule1->genotype_naissance - (int)cellule2->genotype_naissance);
+    int diff_efficacite = int_abs((int)cellule1->efficacite_energetique - (int)cellule2->efficacite_energetique);
+    int diff_polarisation = int_abs((int)cellule1->force_polarisation - (int)cellule2->force_polarisation);
+    
+    return (diff_survie + diff_naissance + diff_efficacite + diff_polarisation) / 4;
+}
+*/
+
+// Détermine l'espèce selon la distance génétique et l'environnement local
+static uint8_t determiner_espece(CelluleEvolutive* parents[], int nombre_parents, 
+                                int position_x, int position_y, int largeur, int hauteur) {
+    if (nombre_parents == 0) return 0;
+    
+    // Espèce basée sur la niche écologique spatiale
+    int ouest = (2 * position_x < largeur);
+    int nord = (2 * position_y < hauteur);
+    
+    // 4 zones écologiques principales créant une pression de spéciation
+    if (ouest && nord) return 1;        // Nord-Ouest
+    else if (!ouest && nord) return 2;  // Nord-Est  
+    else if (ouest && !nord) return 3;  // Sud-Ouest
+    else return 4;                      // Sud-Est
+}
+
+// Obtient les coordonnées d'une direction relative
+static void obtenir_coordonnees_direction(DirectionPolarisation direction, int* delta_x, int* delta_y) {
+    switch (direction) {
+        case DIRECTION_NORD:       *delta_x = 0;  *delta_y = -1; break;
+        case DIRECTION_NORD_EST:   *delta_x = 1;  *delta_y = -1; break;
+        case DIRECTION_EST:        *delta_x = 1;  *delta_y = 0;  break;
+        case DIRECTION_SUD_EST:    *delta_x = 1;  *delta_y = 1;  break;
+        case DIRECTION_SUD:        *delta_x = 0;  *delta_y = 1;  break;
+        case DIRECTION_SUD_OUEST:  *delta_x = -1; *delta_y = 1;  break;
+        case DIRECTION_OUEST:      *delta_x = -1; *delta_y = 0;  break;
+        case DIRECTION_NORD_OUEST: *delta_x = -1; *delta_y = -1; break;
+        default:                   *delta_x = 0;  *delta_y = 0;  break;
+    }
+}
+
+// Détermine si une cellule doit bouger selon sa race et ses paramètres
+static int doit_se_deplacer(CelluleEvolutive* cellule, int nombre_voisins) {
+    switch (cellule->race) {
+        case RACE_EXPLORATRICE:
+            // Se déplace plus souvent quand il y a peu de voisins
+            return (nombre_voisins <= 2) && (cellule->compteur_mouvement % RYTHME_MOUVEMENT_RAPIDE == 0);
+            
+        case RACE_COLONISATRICE:
+            // Se déplace rarement, préfère rester en groupe
+            return (nombre_voisins == 0) && (cellule->compteur_mouvement % RYTHME_MOUVEMENT_LENT == 0);
+            
+        case RACE_NOMADE:
+            // Se déplace constamment
+            return (cellule->compteur_mouvement % RYTHME_MOUVEMENT_RAPIDE == 0);
+            
+        case RACE_ADAPTATIVE:
+            // Se déplace selon les conditions : fuit la surpopulation, cherche les zones moyennement peuplées
+            return (nombre_voisins > 4 || nombre_voisins == 0) && 
+                   (cellule->compteur_mouvement % (RYTHME_MOUVEMENT_RAPIDE + 1) == 0);
+            
+        default:
+            return 0;
+    }
+}
+
+// Calcule la fertilité d'une cellule selon son âge
+static uint32_t calculer_fertilite(uint8_t age) {
+    if (age < FERTILITE_DEBUT) return 0;
+    if (age >= AGE_MAXIMUM) return 0;
+    
+    if (age <= FERTILITE_OPTIMALE) {
+        // Montée progressive de 0 à 1 (Q8)
+        return ((uint32_t)(age - FERTILITE_DEBUT) * 256) / (FERTILITE_OPTIMALE - FERTILITE_DEBUT);
+    } else if (age <= FERTILITE_DECLIN) {
+        // Plateau optimal
+        return 256;
+    } else {
+        // Déclin progressif
+        return 256 - ((uint32_t)(age - FERTILITE_DECLIN) * 256) / (AGE_MAXIMUM - FERTILITE_DECLIN);
+    }
+}
+
+// Calcule la race héritée avec possibilité de mixité génétique
+static RaceCellule calculer_race_herite(CelluleEvolutive* parents[], int nombre_parents, uint32_t* generateur) {
+    if (nombre_parents == 0) return RACE_EXPLORATRICE;
+    
+    // Vérifier s'il y a mixité génétique (différentes races parmi les parents)
+    RaceCellule race_dominante = parents[0]->race;
+    int mixite_presente = 0;
+    
+    for (int i = 1; i < nombre_parents; i++) {
+        if (parents[i]->race != race_dominante) {
+            mixite_presente = 1;
+            break;
+        }
+    }
+    
+    *generateur = tirer();
+    
+    if (mixite_presente && (TIRAGE_PRINCIPAL(*generateur, 100) < MIXITE_GENETIQUE_CHANCE)) {
+        // Création d'une race hybride adaptative
+        return RACE_ADAPTATIVE;
+    } else if (TIRAGE_PRINCIPAL(*generateur, 100) < HERITAGE_RACE_PROBABILITE) {
+        // Héritage normal de la race dominante
+        return race_dominante;
+    } else {
+        // Mutation vers une race aléatoire
+        return (RaceCellule)TIRAGE_SECONDAIRE(*generateur, NOMBRE_RACES);
+    }
+}
+
+// Calcule la polarisation héritée avec variations
+static DirectionPolarisation calculer_polarisation_herite(CelluleEvolutive* parents[], int nombre_parents, uint32_t* generateur) {
+    if (nombre_parents == 0) return DIRECTION_NORD;
+    
+    // Moyenne des polarisations parentales avec variation
+    int somme_directions = 0;
+    for (int i = 0; i < nombre_parents; i++) {
+        somme_directions += parents[i]->polarisation;
+    }
+    int direction_moyenne = somme_directions / nombre_parents;
+    
+    // Variation génétique de la direction
+    *generateur = tirer();
+    int variation = (int)TIRAGE_PRINCIPAL(*generateur, 5) - 2;  // -2 à +2
+    direction_moyenne = (direction_moyenne + variation + NOMBRE_DIRECTIONS) % NOMBRE_DIRECTIONS;
+    
+    return (DirectionPolarisation)direction_moyenne;
+}
+
+// Calcule l'âge initial d'une cellule née de plusieurs parents
+static uint8_t calculer_age_herite(CelluleEvolutive* parents[], int nombre_parents, uint32_t* generateur) {
+    if (nombre_parents == 0) return 0;
+    
+    // Moyenne des âges parentaux
+    uint32_t somme_ages = 0;
+    for (int i = 0; i < nombre_parents; i++) {
+        somme_ages += parents[i]->age;
+    }
+    uint32_t age_moyen_parents = somme_ages / nombre_parents;
+    
+    // Héritage partiel selon facteur génétique
+    uint32_t age_herite = (age_moyen_parents * FACTEUR_HEREDITE) / 100;
+    
+    // Mutation génétique (variation aléatoire)
+    *generateur = tirer();
+    if (TIRAGE_PRINCIPAL(*generateur, 100) < TAUX_MUTATION) {
+        int mutation = (int)TIRAGE_SECONDAIRE(*generateur, 2 * VARIATION_MUTATION + 1) - VARIATION_MUTATION;
+        age_herite = (age_herite + mutation < 0) ? 0 : age_herite + mutation;
+    }
+    
+    return (age_herite > 255) ? 255 : (uint8_t)age_herite;
+}
+
+
+/**
+ * Updates environmental factors with realistic biological cycles
+ * Implements predation, disease, food scarcity, and territorial pressure
+ */
+static void mettre_a_jour_environnement(AutomateReference *automate) {
+    int largeur = automate->largeur_grille;
+    int hauteur = automate->hauteur_grille;
+    uint32_t generation = automate->generation_actuelle;
+    
+    // Calculate global environmental factors
+    uint32_t disponibilite_nourriture = calculer_disponibilite_nourriture(generation);
+    
+    for (int ligne = 0; ligne < hauteur; ligne++) {
+        for (int colonne = 0; colonne < largeur; colonne++) {
+            int position = ligne * largeur + colonne;
+            EnvironnementLocal* env = &automate->grille_environnement[position];
+            
+            // Count local population density for realistic environmental pressure
+            int densite_locale = 0;
+            for (int dy = -1; dy <= 1; dy++) {
+                for (int dx = -1; dx <= 1; dx++) {
+                    int vx = (colonne + dx + largeur) % largeur;
+                    int vy = (ligne + dy + hauteur) % hauteur;
+                    if (automate->grille_cellules_actuelles[vy * largeur + vx].vivante) {
+                        densite_locale++;
+                    }
+                }
+            }
+            
+            // Update nutrient availability based on seasonal cycles
+            int nutriments_max = (int)(NUTRIMENTS_INITIAUX * disponibilite_nourriture / 256);
+            if (env->nutriments < nutriments_max) {
+                env->nutriments += REGENERATION_NUTRIMENTS;
+                if (env->nutriments > nutriments_max) {
+                    env->nutriments = nutriments_max;
+                }
+            } else if (env->nutriments > nutriments_max) {
+                env->nutriments -= 1;  // Gradual decrease during scarcity
+            }
+            
+            // Update predation pressure (realistic predator-prey dynamics)
+            env->pression_predation = calculer_pression_predation(generation, colonne, ligne, largeur, hauteur);
+            
+            // Update disease presence (epidemiological modeling)
+            env->pathogenes_present = calculer_pathogenes(generation, densite_locale);
+            
+            // Territorial competition increases with local density
+            env->competition_territoriale = (densite_locale > MIGRATION_PRESSURE_THRESHOLD) ? 
+                                          (densite_locale * TERRITORIAL_COMPETITION) : 0;
+            
+            // Environmental toxicity (pollution from overcrowding)
+            if (densite_locale > 6) {
+                env->toxicite_locale = (densite_locale - 6) * 20;
+            } else {
+                env->toxicite_locale = (env->toxicite_locale > 0) ? env->toxicite_locale - 5 : 0;
+            }
+        }
+    }
+}
+
+/**
+ * Calculates next generation with advanced biological realism
+ * 
+ * This function implements a comprehensive evolutionary simulation including:
+ * - Realistic predator-prey dynamics with spatial gradients
+ * - Epidemic disease spread and resistance evolution
+ * - Environmental stress adaptation and mutation
+ * - Seasonal resource cycles and territorial competition
+ * - Multi-trait inheritance with stress-adaptive mutation rates
+ * 
+ * @param automate Pointer to the cellular automaton structure
+ * @note This function prevents evolutionary stagnation through realistic biological pressures
+ */
+void calculer_generation_reference(AutomateReference *automate) {
+    // Safety checks
+    if (!automate || !automate->grille_cellules_actuelles || !automate->grille_cellules_suivantes) return;
+    
+    int largeur = automate->largeur_grille, hauteur = automate->hauteur_grille;
+    uint32_t generateur;
+    cle_tirages = melanger_32(automate->graine_aleatoire ^ melanger_32(automate->generation_actuelle + 0x9E3779B9u));
+    automate->population_totale = 0;
+    
+    // 1) Mettre à jour l'environnement
+    mettre_a_jour_environnement(automate);
+    
+    // 2) Calculer le nouvel état pour chaque cellule
+    for (int ligne = 0; ligne < hauteur; ligne++) {
+        for (int colonne = 0; colonne < largeur; colonne++) {
+            int position_cellule = ligne * largeur + colonne;
+            CelluleEvolutive* cellule_actuelle = &automate->grille_cellules_actuelles[position_cellule];
+            CelluleEvolutive* cellule_suivante = &automate->grille_cellules_suivantes[position_cellule];
+            EnvironnementLocal* environnement = &automate->grille_environnement[position_cellule];
+            ouvrir_tirages(position_cellule, 0);
+            
+            // Initialiser la cellule suivante comme morte
+            cellule_suivante->vivante = 0;
+            cellule_suivante->age = 0;
+            cellule_suivante->genotype_survie = 0;
+            cellule_suivante->genotype_naissance = 0;
+            cellule_suivante->sante = 0;
+            
+            // Collecter les voisins vivants et leurs propriétés
+            CelluleEvolutive* voisins_parents[8];
+            int nombre_voisins_vivants = 0;
+            int nombre_parents_fertiles = 0;
+            
+            for (int decalage_ligne = -1; decalage_ligne <= 1; decalage_ligne++) {
+                for (int decalage_colonne = -1; decalage_colonne <= 1; decalage_colonne++) {
+                    if (decalage_ligne == 0 && decalage_colonne == 0) continue;
+                    
+                    int ligne_voisin = (ligne + decalage_ligne + hauteur) % hauteur;
+                    int colonne_voisin = (colonne + decalage_colonne + largeur) % largeur;
+                    CelluleEvolutive* voisin = &automate->grille_cellules_actuelles[ligne_voisin * largeur + colonne_voisin];
+                    
+                    if (voisin->vivante) {
+                        nombre_voisins_vivants++;
+                        
+                        // Vérifier la fertilité du voisin (seuil plus permissif)
+                        uint32_t fertilite = calculer_fertilite(voisin->age);
+                        if (fertilite >= Q8(0.1) && nombre_parents_fertiles < 8) {  // Seuil réduit (> 0.1)
+                            voisins_parents[nombre_parents_fertiles] = voisin;
+                            nombre_parents_fertiles++;
+                        }
+                    }
+                }
+            }
+            
+            if (cellule_actuelle->vivante) {
+                // ===== CELLULE VIVANTE : SURVIE ? =====
+                
+                // Application des règles de survie modifiées par génotype, avant toute biologie :
+                // une cellule que la règle condamne meurt sans consommer ni tirer
+                uint16_t masque_survie_adapte = automate->masque_conditions_survie;
+                // Modification légère selon génotype (rend certaines cellules plus résistantes)
+                if (cellule_actuelle->genotype_survie > 128) {
+                    masque_survie_adapte |= (1u << (nombre_voisins_vivants + 1));  // Tolère un voisin de plus
+                } else if (cellule_actuelle->genotype_survie < 64 && nombre_voisins_vivants > 0) {
+                    masque_survie_adapte &= ~(1u << (nombre_voisins_vivants - 1));  // Tolère un voisin de moins
+                }
+                if (!(masque_survie_adapte & (1u << nombre_voisins_vivants))) {
+                    continue;  // Reste morte
+                }
+                
+                // VIEILLISSEMENT ACCÉLÉRÉ POUR EMPÊCHER STABILITÉ
+                // Vieillissement normal
+                uint8_t increment_age = 1;
+                
+                // Accélération du vieillissement pour les cellules anciennes
+                if (cellule_actuelle->age > ACCELERATION_VIEILLISSEMENT) {
+                    increment_age = FACTEUR_ACCELERATION;
+                }
+                
+                cellule_suivante->age = cellule_actuelle->age + increment_age;
+                
+                // Mort de vieillesse
+                if (cellule_suivante->age >= AGE_MAXIMUM) {
+                    continue;  // Reste morte
+                }
+                
+                // Consommation de base
+                int consommation_base = CONSOMMATION_NUTRIMENTS;
+                
+                // Compétition naturelle pour les ressources (biologie réaliste)
+                if (nombre_voisins_vivants >= SEUIL_COMPETITION) {
+                    // En cas de compétition, chaque cellule accède à moins de ressources
+                    int ressources_disponibles = environnement->nutriments / (1 + nombre_voisins_vivants / 2);
+                    if (ressources_disponibles >= consommation_base) {
+                        environnement->nutriments -= consommation_base;
+                        cellule_suivante->sante = cellule_actuelle->sante; // Stable mais pas d'amélioration
+                        // Léger stress de compétition
+                        if (cellule_suivante->sante > STRESS_COMPETITION) {
+                            cellule_suivante->sante -= STRESS_COMPETITION;
+                        }
+                    } else {
+                        // Ressources insuffisantes en compétition
+                        cellule_suivante->sante = (cellule_actuelle->sante > 3) ? cellule_actuelle->sante - 3 : 0;
+                    }
+                } else {
+                    // Pas de compétition : croissance normale
+                    if (environnement->nutriments >= consommation_base) {
+                        environnement->nutriments -= consommation_base;
+                        cellule_suivante->sante = (cellule_actuelle->sante < 100) ? cellule_actuelle->sante + 1 : 100;
+                    } else {
+                        // Malnutrition légère
+                        cellule_suivante->sante = (cellule_actuelle->sante > 2) ? cellule_actuelle->sante - 2 : 0;
+                    }
+                }
+                
+                // Vieillissement naturel (perte progressive avec l'âge)
+                if (cellule_suivante->age > FERTILITE_DECLIN) {
+                    int perte_age = (cellule_suivante->age - FERTILITE_DECLIN) / 20;  // Vieillissement progressif
+                    cellule_suivante->sante = (cellule_suivante->sante > perte_age) ? 
+                                            cellule_suivante->sante - perte_age : 0;
+                }
+                
+                // === REALISTIC BIOLOGICAL SURVIVAL FACTORS ===
+                
+                // Disease mortality check (epidemiological realism)
+                if (environnement->pathogenes_present > 0) {
+                    generateur = tirer();
+                    // Survie avec probabilité (résistance / 255) / (risque / 255 + 0.1)
+                    uint32_t resistance_disease = cellule_actuelle->resistance_maladie;
+                    uint32_t risk_disease = environnement->pathogenes_present;
+                    
+                    if ((generateur >> 16) * (2 * risk_disease + 51) > resistance_disease * 2 * 65536) {
+                        continue;  // Death by disease
+                    }
+                }
+                
+                // Predation mortality check (predator-prey dynamics)
+                if (environnement->pression_predation > 0) {
+                    generateur = tirer();
+                    uint32_t camouflage_effectiveness = cellule_actuelle->camouflage_predation;
+                    
+                    if ((generateur >> 16) * 255 > camouflage_effectiveness * 65536 &&
+                        environnement->pression_predation > Q8(0.2)) {
+                        continue;  // Death by predation
+                    }
+                }
+                
+                // Environmental toxicity effects
+                if (environnement->toxicite_locale > 100) {
+                    cellule_suivante->sante = (cellule_suivante->sante > 2) ? cellule_suivante->sante - 2 : 0;
+                }
+                
+                // Basic malnutrition check (more permissive)
+                if (cellule_suivante->sante < 1) {
+                    continue;  // Death by starvation
+                }
+                
+                // INSTABILITÉ GÉNÉTIQUE PROGRESSIVE 
+                // L'instabilité augmente avec l'âge et les générations pour empêcher les structures stables
+                uint32_t instabilite_totale = 0;
+                if (cellule_suivante->age > SEUIL_INSTABILITE_AGE) {
+                    instabilite_totale += (cellule_suivante->age - SEUIL_INSTABILITE_AGE) / 10;
+                }
+                instabilite_totale += automate->generation_actuelle / (uint32_t)(10000 / INSTABILITE_GENERATION);  // Très réduit
+                
+                // Chance de mutation spontanée progressive (très réduite)
+                generateur = tirer();
+                if (TIRAGE_PRINCIPAL(generateur, 1000) < instabilite_totale) {  // Changé de % 100 à % 1000 pour réduire drastiquement
+                    // Instabilité : survie/mort aléatoire qui brise les patterns stables
+                    if (TIRAGE_SECONDAIRE(generateur, 100) < 10) {  // Réduit de 30% à 10% de chance de mort spontanée
+                        continue;  // Mort par instabilité génétique
+                    }
+                }
+                
+                // MORTALITÉ FORCÉE PAR HAUTE DENSITÉ LOCALE
+                // Empêche les blocs stables en forçant la mort en zones denses
+                if (nombre_voisins_vivants >= SEUIL_DENSITE_FATALE) {
+                    generateur = tirer();
+                    if (TIRAGE_PRINCIPAL(generateur, 100) < CHANCE_MORT_DENSITE) {
+                        continue;  // Mort par surpopulation locale
+                    }
+                }
+                
+                // Survie ! (règle vérifiée avant toute biologie)
+                cellule_suivante->vivante = 1;
+                cellule_suivante->genotype_survie = cellule_actuelle->genotype_survie;
+                cellule_suivante->genotype_naissance = cellule_actuelle->genotype_naissance;
+                
+                // Conservation des propriétés de race et mouvement
+                cellule_suivante->race = cellule_actuelle->race;
+                cellule_suivante->polarisation = cellule_actuelle->polarisation;
+                cellule_suivante->force_polarisation = cellule_actuelle->force_polarisation;
+                cellule_suivante->compteur_mouvement = cellule_actuelle->compteur_mouvement + 1;
+                
+                // Conservation des traits évolutifs et biologiques
+                cellule_suivante->fitness_reproductif = cellule_actuelle->fitness_reproductif;
+                cellule_suivante->efficacite_energetique = cellule_actuelle->efficacite_energetique;
+                cellule_suivante->espece_id = cellule_actuelle->espece_id;
+                cellule_suivante->resistance_maladie = cellule_actuelle->resistance_maladie;
+                cellule_suivante->camouflage_predation = cellule_actuelle->camouflage_predation;
+                cellule_suivante->territorialite = cellule_actuelle->territorialite;
+                cellule_suivante->adaptabilite_stress = cellule_actuelle->adaptabilite_stress;
+                cellule_suivante->generation_naissance = cellule_actuelle->generation_naissance;
+                
+                automate->population_totale++;
+                
+            } else {
+                // ===== CELLULE MORTE : NAISSANCE ? =====
+                
+                // CONDITIONS ÉVOLUTIVES DE REPRODUCTION AVEC FITNESS DIFFÉRENTIEL
+                // Seuls les voisinages acceptés par la règle de naissance font intervenir la biologie
+                if ((automate->masque_conditions_naissance & (1u << nombre_voisins_vivants)) &&
+                    nombre_parents_fertiles >= 1 && environnement->nutriments >= (CONSOMMATION_NUTRIMENTS * 2)) {
+                    
+                    // Calcul du fitness moyen des parents (pression de sélection)
+                    uint32_t fitness_total = 0;
+                    uint32_t fertilite_total = 0;
+                    
+                    for (int i = 0; i < nombre_parents_fertiles; i++) {
+                        uint32_t fertilite = calculer_fertilite(voisins_parents[i]->age);
+                        uint8_t fitness_parent = calculer_fitness_evolutif(voisins_parents[i], 
+                                                                         colonne, ligne, 
+                                                                         automate->generation_actuelle,
+                                                                         largeur, hauteur);
+                        fitness_total += fitness_parent;
+                        fertilite_total += fertilite;
+                    }
+                    
+                    uint32_t fitness_moyen = fitness_total / nombre_parents_fertiles;
+                    uint32_t probabilite_naissance = fertilite_total / nombre_parents_fertiles;
+                    
+                    // Bonus de fitness : meilleurs parents = plus de descendants (Q8 x Q8 = Q16)
+                    probabilite_naissance *= 128 + fitness_moyen * 257 / 512;
+                    
+                    // Appliquer les règles de naissance
+                    generateur = tirer();
+                    uint32_t seuil_naissance = generateur >> 16;
+                    
+                    if (seuil_naissance < probabilite_naissance) {
+                        
+                        // NAISSANCE avec dispersion !
+                        cellule_suivante->vivante = 1;
+                        
+                        // Héritage de l'âge des parents avec moins de pénalité
+                        cellule_suivante->age = calculer_age_herite(voisins_parents, nombre_parents_fertiles, &generateur);
+                        
+                        // HÉRITAGE DE RACE ET POLARISATION
+                        cellule_suivante->race = calculer_race_herite(voisins_parents, nombre_parents_fertiles, &generateur);
+                        cellule_suivante->polarisation = calculer_polarisation_herite(voisins_parents, nombre_parents_fertiles, &generateur);
+                        generateur = tirer();
+                        cellule_suivante->force_polarisation = FORCE_POLARISATION_INITIALE + TIRAGE_PRINCIPAL(generateur, 64);
+                        cellule_suivante->compteur_mouvement = 0;
+                        
+                        // HÉRITAGE DES TRAITS ÉVOLUTIFS AVEC MUTATIONS
+                        // Fitness reproductif : moyenne des parents + mutation
+                        uint32_t fitness_herite = 0;
+                        uint32_t efficacite_herite = 0;
+                        for (int i = 0; i < nombre_parents_fertiles; i++) {
+                            fitness_herite += voisins_parents[i]->fitness_reproductif;
+                            efficacite_herite += voisins_parents[i]->efficacite_energetique;
+                        }
+                        fitness_herite /= nombre_parents_fertiles;
+                        efficacite_herite /= nombre_parents_fertiles;
+                        
+                        // === REALISTIC EVOLUTIONARY MUTATIONS WITH STRESS ADAPTATION ===
+                        
+                        // Calculate environmental stress level for mutation rate adaptation
+                        uint32_t stress_level = (environnement->pathogenes_present * Q8(0.3) +
+                                                 environnement->pression_predation * Q8(0.4) +
+                                                 environnement->toxicite_locale * Q8(0.2)) / 256;
+                        stress_level += (nombre_voisins_vivants > MIGRATION_PRESSURE_THRESHOLD) ? Q8(0.1) : 0;
+                        
+                        // Adaptive mutation rate: higher under stress (realistic biological response)
+                        uint32_t taux_mutation_adaptatif = BASE_MUTATION_RATE + 
+                                                          stress_level * STRESS_MUTATION_MULTIPLIER / 256;
+                        
+                        // Fitness evolution with stress-adaptive mutations
+                        generateur = tirer();
+                        if (TIRAGE_PRINCIPAL(generateur, 100) < taux_mutation_adaptatif) {
+                            int mutation_fitness = (int)TIRAGE_SECONDAIRE(generateur, 21) - 10;  // -10 à +10
+                            fitness_herite = (fitness_herite + mutation_fitness < 0) ? 0 : 
+                                           (fitness_herite + mutation_fitness > 255) ? 255 : 
+                                           fitness_herite + mutation_fitness;
+                        }
+                        
+                        // Energy efficiency evolution
+                        generateur = tirer();
+                        if (TIRAGE_PRINCIPAL(generateur, 100) < taux_mutation_adaptatif) {
+                            int mutation_efficacite = (int)TIRAGE_SECONDAIRE(generateur, 21) - 10;
+                            efficacite_herite = (efficacite_herite + mutation_efficacite < 0) ? 0 : 
+                                              (efficacite_herite + mutation_efficacite > 255) ? 255 : 
+                                              efficacite_herite + mutation_efficacite;
+                        }
+                        
+                        // === BIOLOGICAL TRAIT INHERITANCE WITH EVOLUTION ===
+                        
+                        // Disease resistance inheritance (crucial for epidemic survival)
+                        uint32_t resistance_moyenne = 0;
+                        for (int i = 0; i < nombre_parents_fertiles; i++) {
+                            resistance_moyenne += voisins_parents[i]->resistance_maladie;
+                        }
+                        resistance_moyenne /= nombre_parents_fertiles;
+                        
+                        generateur = tirer();
+                        if (TIRAGE_PRINCIPAL(generateur, 100) < RESISTANCE_EVOLUTION_RATE) {
+                            int mutation_resistance = (int)TIRAGE_SECONDAIRE(generateur, 31) - 15;  // -15 to +15
+                            resistance_moyenne = (resistance_moyenne + mutation_resistance < 0) ? 0 :
+                                               (resistance_moyenne + mutation_resistance > 255) ? 255 :
+                                               resistance_moyenne + mutation_resistance;
+                        }
+                        
+                        // Predation camouflage inheritance
+                        uint32_t camouflage_moyen = 0;
+                        for (int i = 0; i < nombre_parents_fertiles; i++) {
+                            camouflage_moyen += voisins_parents[i]->camouflage_predation;
+                        }
+                        camouflage_moyen /= nombre_parents_fertiles;
+                        
+                        generateur = tirer();
+                        if (TIRAGE_PRINCIPAL(generateur, 100) < taux_mutation_adaptatif) {
+                            int mutation_camouflage = (int)TIRAGE_SECONDAIRE(generateur, 21) - 10;
+                            camouflage_moyen = (camouflage_moyen + mutation_camouflage < 0) ? 0 :
+                                             (camouflage_moyen + mutation_camouflage > 255) ? 255 :
+                                             camouflage_moyen + mutation_camouflage;
+                        }
+                        
+                        // Set all inherited traits
+                        cellule_suivante->fitness_reproductif = (uint8_t)fitness_herite;
+                        cellule_suivante->efficacite_energetique = (uint8_t)efficacite_herite;
+                        cellule_suivante->resistance_maladie = (uint8_t)resistance_moyenne;
+                        cellule_suivante->camouflage_predation = (uint8_t)camouflage_moyen;
+                        cellule_suivante->territorialite = (voisins_parents[0]->territorialite + 
+                                                          ((int)TIRAGE_PRINCIPAL(generateur, 21) - 10)) % 256;
+                        cellule_suivante->adaptabilite_stress = (voisins_parents[0]->adaptabilite_stress + 
+                                                               (int)TIRAGE_SECONDAIRE(generateur, 21) - 10) % 256;
+                        cellule_suivante->generation_naissance = (uint8_t)(automate->generation_actuelle % 256);
+                        cellule_suivante->espece_id = determiner_espece(voisins_parents, nombre_parents_fertiles, 
+                                                                       colonne, ligne, largeur, hauteur);
+                        
+                        // DISPERSION : Les descendants ont tendance à éviter la surpopulation
+                        // En zone dense, réduire la probabilité de reproduction
+                        if (nombre_voisins_vivants >= 3) {
+                            generateur = tirer();
+                            if (TIRAGE_PRINCIPAL(generateur, 100) < 60) {  // 60% de chance d'échec en zone dense
+                                cellule_suivante->vivante = 0;
+                                continue;
+                            }
+                        }
+                        
+                        // Héritage génétique avec diversification forcée
+                        uint8_t genotype_moyen_survie = 0;
+                        uint8_t genotype_moyen_naissance = 0;
+                        for (int i = 0; i < nombre_parents_fertiles; i++) {
+                            genotype_moyen_survie += voisins_parents[i]->genotype_survie;
+                            genotype_moyen_naissance += voisins_parents[i]->genotype_naissance;
+                        }
+                        genotype_moyen_survie /= nombre_parents_fertiles;
+                        genotype_moyen_naissance /= nombre_parents_fertiles;
+                        
+                        // Augmenter les mutations en zones de compétition pour favoriser l'adaptation
+                        uint32_t taux_mutation_local = TAUX_MUTATION;
+                        if (nombre_voisins_vivants >= SEUIL_COMPETITION) {
+                            taux_mutation_local *= 2;  // Double mutation en compétition
+                        }
+                        
+                        // Application avec taux adaptatif
+                        generateur = tirer();
+                        if (TIRAGE_PRINCIPAL(generateur, 100) < taux_mutation_local) {
+                            int mutation_survie = (int)TIRAGE_SECONDAIRE(generateur, 41) - 20;  // -20 à +20
+                            int mutation_naissance = (int)TIRAGE_TERTIAIRE(generateur, 41) - 20;
+                            genotype_moyen_survie = (genotype_moyen_survie + mutation_survie < 0) ? 0 : 
+                                                  (genotype_moyen_survie + mutation_survie > 255) ? 255 : 
+                                                  genotype_moyen_survie + mutation_survie;
+                            genotype_moyen_naissance = (genotype_moyen_naissance + mutation_naissance < 0) ? 0 : 
+                                                     (genotype_moyen_naissance + mutation_naissance > 255) ? 255 : 
+                                                     genotype_moyen_naissance + mutation_naissance;
+                        }
+                        
+                        cellule_suivante->genotype_survie = genotype_moyen_survie;
+                        cellule_suivante->genotype_naissance = genotype_moyen_naissance;
+                        
+                        // Santé initiale
+                        cellule_suivante->sante = 50;  // Commence en bonne santé
+                        
+                        // Consommer les nutriments pour la naissance (coût réaliste)
+                        environnement->nutriments -= (CONSOMMATION_NUTRIMENTS * 2);
+                        
+                        automate->population_totale++;
+                    }
+                }
+            }
+        }
+    }
+    
+    // 3) Échanger les grilles de cellules
+    CelluleEvolutive *grille_temporaire = automate->grille_cellules_actuelles;
+    automate->grille_cellules_actuelles = automate->grille_cellules_suivantes;
+    automate->grille_cellules_suivantes = grille_temporaire;
+    
+    // 4) PHASE DE MOUVEMENT POLARISÉ (RÉACTIVÉ AVEC PRUDENCE)
+    // Mouvement très occasionnel pour introduire de la dynamique sans déstabiliser
+    // Décisions sur la grille d'avant tout déplacement ; la grille suivante (libre
+    // entre deux générations) reçoit les cellules arrivées et marque les départs
+    if (automate->generation_actuelle % 10 == 0) {  // Seulement toutes les 10 générations
+        int taille_totale = largeur * hauteur;
+        CelluleEvolutive *arrivees = automate->grille_cellules_suivantes;
+        for (int position_cellule = 0; position_cellule < taille_totale; position_cellule++) {
+            arrivees[position_cellule].vivante = 0;
+            arrivees[position_cellule].age = 0;  // 1 : la cellule de ce site part
+        }
+        
+        for (int ligne = 0; ligne < hauteur; ligne++) {
+            for (int colonne = 0; colonne < largeur; colonne++) {
+                int position_cellule = ligne * largeur + colonne;
+                CelluleEvolutive* cellule = &automate->grille_cellules_actuelles[position_cellule];
+                
+                if (cellule->vivante && doit_se_deplacer(cellule, 0)) {
+                    // Calculer position cible selon polarisation
+                    int delta_x, delta_y;
+                    obtenir_coordonnees_direction(cellule->polarisation, &delta_x, &delta_y);
+                    
+                    int nouvelle_ligne = (ligne + delta_y + hauteur) % hauteur;
+                    int nouvelle_colonne = (colonne + delta_x + largeur) % largeur;
+                    int nouvelle_position = nouvelle_ligne * largeur + nouvelle_colonne;
+                    
+                    // Déplacer seulement si la case cible est libre
+                    if (!automate->grille_cellules_actuelles[nouvelle_position].vivante) {
+                        // Effectuer le déplacement avec probabilité réduite
+                        ouvrir_tirages(position_cellule, EMPLACEMENT_MOUVEMENT);
+                        generateur = tirer();
+                        // Seulement 30% de chance de bouger ; la première source en balayage gagne la cible
+                        if (TIRAGE_PRINCIPAL(generateur, 100) < 30 && !arrivees[nouvelle_position].vivante) {
+                            arrivees[nouvelle_position] = *cellule;
+                            arrivees[position_cellule].age = 1;
+                        }
+                    }
+                }
+            }
+        }
+        
+        for (int position_cellule = 0; position_cellule < taille_totale; position_cellule++) {
+            CelluleEvolutive* cellule = &automate->grille_cellules_actuelles[position_cellule];
+            if (arrivees[position_cellule].vivante) {
+                *cellule = arrivees[position_cellule];
+            } else if (arrivees[position_cellule].age) {
+                // Vider l'ancienne position
+                cellule->vivante = 0;
+                cellule->age = 0;
+                cellule->sante = 0;
+                cellule->race = RACE_EXPLORATRICE;
+                cellule->polarisation = DIRECTION_NORD;
+                cellule->force_polarisation = 0;
+                cellule->compteur_mouvement = 0;
+            }
+        }
+    }
+    
+    // 5) Incrémenter le compteur de génération
+    automate->generation_actuelle++;
+}
+
+uint64_t calculer_empreinte_reference(const AutomateReference *automate) {
+    int taille_totale = automate->largeur_grille * automate->hauteur_grille;
+    uint64_t empreinte = empreinte_debut(automate->generation_actuelle, automate->population_totale);
+    for (int position = 0; position < taille_totale; position++) {
+        empreinte = empreinte_ajouter_cellule(empreinte, &automate->grille_cellules_actuelles[position],
+                                              &automate->grille_environnement[position]);
+    }
+    return empreinte;
+}
+
+// Règles B/S pures, cellule par cellule : la définition la plus directe possible
+uint32_t calculer_generation_regles_reference(const uint8_t *actuelle, uint8_t *suivante,
+                                              int largeur, int hauteur,
+                                              uint16_t masque_naissance, uint16_t masque_survie,
+                                              int bord_fixe) {
+    uint32_t population = 0;
+    for (int ligne = 0; ligne < hauteur; ligne++) {
+        for (int colonne = 0; colonne < largeur; colonne++) {
+            int voisins = 0;
+            for (int dy = -1; dy <= 1; dy++) {
+                for (int dx = -1; dx <= 1; dx++) {
+                    if (dx == 0 && dy == 0) continue;
+                    int vy = ligne + dy, vx = colonne + dx;
+                    if (bord_fixe && (vy < 0 || vy >= hauteur || vx < 0 || vx >= largeur)) continue;
+                    vy = (vy + hauteur) % hauteur;
+                    vx = (vx + largeur) % largeur;
+                    voisins += actuelle[vy * largeur + vx];
+                }
+            }
+            int position = ligne * largeur + colonne;
+            uint16_t masque = actuelle[position] ? masque_survie : masque_naissance;
+            suivante[position] = (masque >> voisins) & 1u;
+            population += suivante[position];
+        }
+    }
+    return population;
+}
@@ -0,0 +1,36 @@
+#ifndef CA_REFERENCE_H
+#define CA_REFERENCE_H
+
+#include "ca.h"
+
+/**
+ * Plain array-of-structs state used by the frozen reference kernel
+ * Field names mirror the original AutomateCellulaire so the reference code stays verbatim
+ */
+typedef struct {
+    int largeur_grille;                          // Number of columns in the grid
+    int hauteur_grille;                          // Number of rows in the grid
+    uint16_t masque_conditions_naissance;        // Birth mask (bit n = n neighbors)
+    uint16_t masque_conditions_survie;           // Survival mask
+    CelluleEvolutive *grille_cellules_actuelles; // Current cells
+    CelluleEvolutive *grille_cellules_suivantes; // Scratch buffer for the next generation
+    EnvironnementLocal *grille_environnement;    // Environment of each cell
+    uint32_t graine_aleatoire;                   // Seed, keys the counter-based draws
+    uint32_t generation_actuelle;                // Generation counter
+    uint32_t population_totale;                  // Number of living cells
+} AutomateReference;
+
+// Frozen copy of calculer_generation_suivante, prior to any optimization
+void calculer_generation_reference(AutomateReference *automate);
+
+// Fingerprint of the reference state, same canonical order as calculer_empreinte_etat
+uint64_t calculer_empreinte_reference(const AutomateReference *automate);
+
+// Plain B/S rules on a byte grid (0/1), oracle for MOTEUR_BITBOARD; returns the population
+// bord_fixe = 0: torus, 1: cells beyond the edges are dead (BORD_FIXE)
+uint32_t calculer_generation_regles_reference(const uint8_t *actuelle, uint8_t *suivante,
+                                              int largeur, int hauteur,
+                                              uint16_t masque_naissance, uint16_t masque_survie,
+                                              int bord_fixe);
+
+#endif // CA_REFERENCE_H
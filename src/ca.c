@@ -2,74 +2,206 @@
 
 #define NULL ((void*)0)  // Définition simple de NULL pour kernel bare-metal
 
-// Implémentations simples des fonctions mathématiques pour kernel bare-metal
-static float simple_sin(float x) {
-    // Approximation de Taylor pour sin(x) : x - x³/6 + x⁵/120
-    // Normalisation x dans [-π, π]
-    while (x > 3.14159f) x -= 6.28318f;
-    while (x < -3.14159f) x += 6.28318f;
-    
-    float x2 = x * x;
-    return x * (1.0f - x2/6.0f + x2*x2/120.0f);
+// =============================
+// ARITHMÉTIQUE EN VIRGULE FIXE (Q8 / Q16)
+// =============================
+
+// Quart d'onde sinusoïdale en Q8 : sin(i * pi / 128) * 256, i = 0..64
+static const uint16_t QUART_SINUS_Q8[65] = {
+      0,   6,  13,  19,  25,  31,  38,  44,  50,  56,  62,  68,  74,
+     80,  86,  92,  98, 104, 109, 115, 121, 126, 132, 137, 142, 147,
+    152, 157, 162, 167, 172, 177, 181, 185, 190, 194, 198, 202, 206,
+    209, 213, 216, 220, 223, 226, 229, 231, 234, 237, 239, 241, 243,
+    245, 247, 248, 250, 251, 252, 253, 254, 255, 255, 256, 256, 256,
+};
+
+// Sinus en Q8 (-256..256) d'une phase exprimée en 256e de tour
+static int sinus_q8(uint32_t phase) {
+    uint32_t indice = phase & 63u;
+    int valeur = (phase & 64u) ? QUART_SINUS_Q8[64 - indice] : QUART_SINUS_Q8[indice];
+    return (phase & 128u) ? -valeur : valeur;
+}
+
+static int abs_entier(int x) {
+    return (x < 0) ? -x : x;
+}
+
+// Phase (256e de tour) de la génération dans un cycle de "periode" générations
+#define PHASE_CYCLE(generation, periode) ((((generation) % (periode)) * 256u) / (periode))
+
+/**
+ * Reciprocals ceil(65536 / n) for the divisors 1..8 (parent and neighbor counts):
+ * (somme * INVERSES_Q16[n]) >> 16 == somme / n exactly for every somme < 13110,
+ * well above the 8 x 255 of a sum of byte traits
+ */
+static const uint32_t INVERSES_Q16[9] = { 0, 65536, 32768, 21846, 16384, 13108, 10923, 9363, 8192 };
+
+static inline uint32_t diviser_petit(uint32_t somme, int diviseur) {
+    return (somme * INVERSES_Q16[diviseur]) >> 16;
+}
+
+/**
+ * Draws on 16 bits of the generator word, without modulo: the main draw of a
+ * step uses the high half (best LCG bits), a second draw from the same step
+ * bits 8..23, a third one the low half
+ */
+#define TIRAGE_PRINCIPAL(generateur)  ((generateur) >> 16)
+#define TIRAGE_SECONDAIRE(generateur) (((generateur) >> 8) & 0xFFFFu)
+#define TIRAGE_TERTIAIRE(generateur)  ((generateur) & 0xFFFFu)
+
+/**
+ * Counter-based draws: the word of slot k of a cell is a keyed bijection of the
+ * counter cell x EMPLACEMENTS_PAR_CELLULE + k (odd multiply, key, lowbias32
+ * avalanche), the key mixing the seed and the generation number
+ * No state is carried from one cell to the next: any traversal order, tiling
+ * or split of the grid gives the same draws, and any block of draws can be
+ * computed independently
+ */
+static inline uint32_t melanger_32(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x7FEB352Du;
+    x ^= x >> 15;
+    x *= 0x846CA68Bu;
+    x ^= x >> 16;
+    return x;
+}
+
+// Clé des tirages d'une génération
+static uint32_t cle_generation(const AutomateCellulaire *automate) {
+    return melanger_32(automate->graine_aleatoire ^ melanger_32(automate->generation_actuelle + 0x9E3779B9u));
+}
+
+/**
+ * Position in the whole grid of a site: a scratch grid of the temporal blocking
+ * (see avancer_generations) holds the rows from ligne_origine on of a grid of
+ * hauteur_origine rows, across the seam of a torus, and draws, species zones and
+ * movement order follow the whole grid. Outside scratch grids hauteur_origine is
+ * 0 and a position is its own
+ */
+static inline int position_origine(const AutomateCellulaire *automate, int position) {
+    int taille_origine = automate->hauteur_origine * automate->largeur_grille;
+    int position_grille = position + automate->ligne_origine * automate->largeur_grille;
+    return (position_grille >= taille_origine) ? position_grille - taille_origine : position_grille;
+}
+
+static inline int hauteur_grille_origine(const AutomateCellulaire *automate) {
+    return automate->hauteur_origine ? automate->hauteur_origine : automate->hauteur_grille;
+}
+
+// Flux de tirages d'une cellule : emplacements consécutifs à partir d'un premier
+typedef struct {
+    uint32_t cle;
+    uint32_t compteur;
+} FluxAleatoire;
+
+static inline FluxAleatoire ouvrir_flux(uint32_t cle, int position, uint32_t premier_emplacement) {
+    FluxAleatoire flux = { cle, (uint32_t)position * EMPLACEMENTS_PAR_CELLULE + premier_emplacement };
+    return flux;
+}
+
+static inline uint32_t tirer_flux(FluxAleatoire *flux) {
+    return melanger_32(flux->compteur++ * 0x9E3779B9u + flux->cle);
 }
 
-static float simple_abs(float x) {
-    return (x < 0.0f) ? -x : x;
+// Tirage uniforme dans [0, n) par multiplication-décalage de 16 bits aléatoires
+static inline uint32_t tirer_borne(uint32_t bits, uint32_t n) {
+    return (bits * n) >> 16;
 }
 
+// Instabilité due à la génération : generation x INSTABILITE_GENERATION / 10000, divisée par une constante
+#define DIVISEUR_INSTABILITE ((uint32_t)(10000 / INSTABILITE_GENERATION))
+
+// Un voisin compte comme parent au-delà de 10 % de fertilité (25.6 en Q8)
+#define SEUIL_PARENT_FERTILE Q8(0.1)
+
+// Fertilité d'une cellule selon son âge, en Q8 (256 = pleinement fertile) : montée
+// progressive de FERTILITE_DEBUT à FERTILITE_OPTIMALE, plateau jusqu'à FERTILITE_DECLIN,
+// puis déclin jusqu'à AGE_MAXIMUM
+#define FERTILITE_Q8(age) \
+    (((age) < FERTILITE_DEBUT || (age) >= AGE_MAXIMUM) ? 0 : \
+     ((age) <= FERTILITE_OPTIMALE) ? ((age) - FERTILITE_DEBUT) * 256 / (FERTILITE_OPTIMALE - FERTILITE_DEBUT) : \
+     ((age) <= FERTILITE_DECLIN) ? 256 : \
+     256 - ((age) - FERTILITE_DECLIN) * 256 / (AGE_MAXIMUM - FERTILITE_DECLIN))
+#define FERTILITE_Q8_4(age)   FERTILITE_Q8(age), FERTILITE_Q8((age) + 1), FERTILITE_Q8((age) + 2), FERTILITE_Q8((age) + 3)
+#define FERTILITE_Q8_16(age)  FERTILITE_Q8_4(age), FERTILITE_Q8_4((age) + 4), FERTILITE_Q8_4((age) + 8), FERTILITE_Q8_4((age) + 12)
+#define FERTILITE_Q8_64(age)  FERTILITE_Q8_16(age), FERTILITE_Q8_16((age) + 16), FERTILITE_Q8_16((age) + 32), FERTILITE_Q8_16((age) + 48)
+
+// Fertilité en Q8 pour chaque âge : ne dépend que de la configuration, calculée à la compilation
+static const uint16_t fertilite_par_age[256] = {
+    FERTILITE_Q8_64(0), FERTILITE_Q8_64(64), FERTILITE_Q8_64(128), FERTILITE_Q8_64(192)
+};
+
 // Déclarations forward pour éviter les erreurs de compilation
-static float calculer_fertilite(uint8_t age);
-static uint8_t determiner_espece(CelluleEvolutive* parents[], int nombre_parents, 
+static uint8_t determiner_espece(const uint32_t positions_parents[], int nombre_parents, 
                                 int position_x, int position_y, int largeur, int hauteur);
 
 /**
- * Calculates predation pressure for a given generation and position
- * Implements realistic predator-prey cycles
+ * Static part of the predation pressure (Q8): gradient higher at the edges
+ * (predators hunt from outside); the cyclic intensity is applied per generation
  */
-static uint8_t calculer_pression_predation(uint32_t generation, int x, int y, int largeur, int hauteur) {
-    float cycle_predation = 2.0f * 3.14159f * generation / PREDATION_CYCLE;
-    float intensite_base = 0.5f + 0.5f * simple_sin(cycle_predation);
-    
-    // Predation gradient: higher at edges (predators hunt from outside)
-    float distance_bord_x = (x < largeur/2) ? (float)x / (largeur/2) : (float)(largeur-x) / (largeur/2);
-    float distance_bord_y = (y < hauteur/2) ? (float)y / (hauteur/2) : (float)(hauteur-y) / (hauteur/2);
-    float distance_centre = 1.0f - (distance_bord_x + distance_bord_y) / 2.0f;
-    
-    float pression_finale = intensite_base * (0.3f + 0.7f * distance_centre) * PREDATION_PRESSURE;
-    return (pression_finale > 255.0f) ? 255 : (uint8_t)pression_finale;
+static uint16_t calculer_gradient_predation(int x, int y, int largeur, int hauteur) {
+    int demi_largeur = (largeur / 2 > 0) ? largeur / 2 : 1;
+    int demi_hauteur = (hauteur / 2 > 0) ? hauteur / 2 : 1;
+    int distance_bord_x = ((x < largeur/2) ? x * 256 : (largeur-x) * 256) / demi_largeur;
+    int distance_bord_y = ((y < hauteur/2) ? y * 256 : (hauteur-y) * 256) / demi_hauteur;
+    int distance_centre = 256 - (distance_bord_x + distance_bord_y) / 2;
+    int gradient = Q8(0.3) + Q8(0.7) * distance_centre / 256;
+    return (gradient < 0) ? 0 : (uint16_t)gradient;
+}
+
+// Fitness spatial (Q8) : avantage selon la position (niches écologiques)
+static uint16_t calculer_niche_ecologique(int x, int y, int largeur, int hauteur) {
+    int distance_centre_x = 2 * 256 * x / largeur - 256;  // -1 à 1
+    int distance_centre_y = 2 * 256 * y / hauteur - 256;  // -1 à 1
+    int distance_carree = (distance_centre_x * distance_centre_x + distance_centre_y * distance_centre_y) / 256;
+    return (uint16_t)(256 - Q8(0.3) * distance_carree / 256);
 }
 
 /**
  * Calculates epidemic disease presence based on population density
- * Realistic disease spread modeling
+ * Realistic disease spread modeling (intensity and density factor in Q8)
+ */
+static uint8_t calculer_pathogenes(uint32_t intensite_epidemie, uint32_t facteur_densite) {
+    uint32_t pathogenes = (intensite_epidemie * facteur_densite * EPIDEMIC_MORTALITY) >> 16;
+    return (pathogenes > 255) ? 255 : (uint8_t)pathogenes;
+}
+
+/**
+ * Evaluates every cycle of the current generation once: predator-prey
+ * intensity, epidemic level for both density classes (disease spreads faster
+ * in dense populations) and the energy cycle seen by the fitness
  */
-static uint8_t calculer_pathogenes(uint32_t generation, int densite_locale) {
-    float cycle_epidemie = 2.0f * 3.14159f * generation / EPIDEMIC_CYCLE;
-    float intensite_epidemie = simple_abs(simple_sin(cycle_epidemie));
+static void preparer_cycles_generation(AutomateCellulaire *automate) {
+    uint32_t generation = automate->generation_actuelle;
+    CyclesGeneration *cycles = &automate->cycles;
     
-    // Disease spreads faster in dense populations (realistic epidemiology)
-    float facteur_densite = (densite_locale > 4) ? 1.5f : 0.8f;
+    int sinus_predation = sinus_q8(PHASE_CYCLE(generation, PREDATION_CYCLE));
+    cycles->intensite_predation = (uint16_t)(Q8(0.5) + sinus_predation / 2);
     
-    float pathogenes = intensite_epidemie * facteur_densite * EPIDEMIC_MORTALITY;
-    return (pathogenes > 255.0f) ? 255 : (uint8_t)pathogenes;
+    uint32_t intensite_epidemie = (uint32_t)abs_entier(sinus_q8(PHASE_CYCLE(generation, EPIDEMIC_CYCLE)));
+    cycles->pathogenes_dense = calculer_pathogenes(intensite_epidemie, Q8(1.5));
+    cycles->pathogenes_clairseme = calculer_pathogenes(intensite_epidemie, Q8(0.8));
+    
+    // Cycle énergétique sinusoïdal créant une pression de sélection variable
+    uint32_t phase_environnementale = PHASE_CYCLE(generation, CYCLES_ENVIRONNEMENTAUX);
+    cycles->coefficient_energetique = (uint16_t)(256 + Q8(0.3) * sinus_q8(phase_environnementale) / 256);
+    cycles->bonus_nomade = (uint16_t)(256 + Q8(0.1) * cycles->coefficient_energetique / 256);  // Avantage lors de cycles favorables
+    cycles->bonus_adaptatif = (uint16_t)(256 + Q8(0.15) * abs_entier(sinus_q8(phase_environnementale * 2)) / 256);  // Avantage lors de changements
 }
 
 /**
- * Calculates food scarcity based on environmental cycles
+ * Calculates food scarcity (Q8) based on environmental cycles
  * Implements seasonal resource availability patterns
  */
-static float calculer_disponibilite_nourriture(uint32_t generation) {
-    float cycle_nourriture = 2.0f * 3.14159f * generation / FOOD_SCARCITY_CYCLE;
-    return 0.6f + 0.4f * simple_sin(cycle_nourriture + 1.57f);  // Shifted sine for seasons
+static uint32_t calculer_disponibilite_nourriture(uint32_t generation) {
+    uint32_t phase_nourriture = PHASE_CYCLE(generation, FOOD_SCARCITY_CYCLE);
+    return (uint32_t)(Q8(0.6) + Q8(0.4) * sinus_q8(phase_nourriture + 64) / 256);  // Shifted sine for seasons
 }
 
 // -------------------------------------------------------------
 // parse des règles au format "B<numeros>/S<numeros>" ex: "B3/S23"
 // -------------------------------------------------------------
-void analyser_regles_automate(AutomateCellulaire *automate) {
-    // Vérification des pointeurs
-    if (!automate || !automate->regles_format_texte) return;
-    
+static void lire_masques_regles(AutomateCellulaire *automate) {
     const char *caractere_actuel = automate->regles_format_texte;
     automate->masque_conditions_naissance = 0;  // Réinitialiser les masques
     automate->masque_conditions_survie = 0;
@@ -106,9 +238,344 @@ void analyser_regles_automate(AutomateCellulaire *automate) {
     }
 }
 
+/**
+ * Precomputes, for every (alive, neighbor count), whether the cell can be alive
+ * at the next generation under the rule
+ * A live cell uses the survival mask, a dead one the birth mask (it can only be
+ * born with at least one neighbor to inherit from)
+ * The genotype adaptation of the original kernel (one more neighbor tolerated
+ * above 128, one less below 64) set or cleared the bits of voisins + 1 and
+ * voisins - 1 but tested the bit of voisins: it never changed the outcome, so
+ * the genotype plays no part here
+ * The generation loop reads this table first: a cell the rule cannot keep or
+ * make alive skips all the biology and draws nothing
+ */
+static void construire_table_transition(AutomateCellulaire *automate) {
+    for (int voisins = 0; voisins <= 8; voisins++) {
+        automate->table_transition[1][voisins] = (automate->masque_conditions_survie >> voisins) & 1u;
+        automate->table_transition[0][voisins] =
+            (voisins > 0) && ((automate->masque_conditions_naissance >> voisins) & 1u);
+    }
+}
+
+void analyser_regles_automate(AutomateCellulaire *automate) {
+    // Vérification des pointeurs
+    if (!automate || !automate->regles_format_texte) return;
+    
+    lire_masques_regles(automate);
+    construire_table_transition(automate);
+}
+
 // -----------------------------------------------------------------
 // remplit ca->grid[i] avec 0 ou 1, taille = width*height, LCG trivial
 // -----------------------------------------------------------------
+// =============================
+// MÉMOIRE ET ACCÈS AUX CELLULES
+// =============================
+
+uint32_t calculer_taille_memoire_automate(int largeur, int hauteur, MoteurAutomate moteur) {
+    if (largeur <= 0 || hauteur <= 0) return 0;
+    if (moteur == MOTEUR_BITBOARD) return TAILLE_MEMOIRE_BITBOARD(largeur, hauteur);
+    return TAILLE_MEMOIRE_AUTOMATE(largeur, hauteur);
+}
+
+// Champs qui ne dépendent que de la position : calculés une fois par taille de grille
+static void preparer_champs_spatiaux(AutomateCellulaire *automate) {
+    int largeur = automate->largeur_grille, hauteur = automate->hauteur_grille;
+    for (int ligne = 0; ligne < hauteur; ligne++) {
+        for (int colonne = 0; colonne < largeur; colonne++) {
+            int position = ligne * largeur + colonne;
+            automate->gradient_predation[position] = calculer_gradient_predation(colonne, ligne, largeur, hauteur);
+            automate->niche_ecologique[position] = calculer_niche_ecologique(colonne, ligne, largeur, hauteur);
+        }
+    }
+}
+
+// Découpe une tranche de "nombre_octets" dans la zone mémoire
+static uint8_t* reserver_tableau(uint8_t **curseur, uint32_t nombre_octets) {
+    uint8_t *tableau = *curseur;
+    *curseur += nombre_octets;
+    return tableau;
+}
+
+/**
+ * Carves the arrays of a MOTEUR_EVOLUTIF grid of largeur_grille x hauteur_grille
+ * from "zone_memoire" (TAILLE_GRILLE_EVOLUTIVE bytes); the static fields are left
+ * to the caller. Returns the first byte after them
+ */
+static uint8_t* reserver_grille_evolutive(AutomateCellulaire *automate, uint8_t *zone_memoire) {
+    uint32_t taille_totale = (uint32_t)(automate->largeur_grille * automate->hauteur_grille);
+    uint32_t taille_plan = TAILLE_PLAN_OCCUPATION(automate->largeur_grille, automate->hauteur_grille);
+    uint32_t mots_par_ligne = MOTS_PAR_LIGNE(automate->largeur_grille);
+    uint8_t *curseur = zone_memoire;
+    
+    // Plan d'occupation en tête de zone pour garder l'alignement des mots ;
+    // le pointeur désigne la ligne 0, la ligne de halo -1 le précède
+    automate->plan_occupation = (uint32_t*)reserver_tableau(&curseur, taille_plan) + mots_par_ligne;
+    
+    // Champs spatiaux statiques (Q8 sur 16 bits, juste après les mots du plan pour l'alignement)
+    automate->gradient_predation = (uint16_t*)reserver_tableau(&curseur, taille_totale * sizeof(uint16_t));
+    automate->niche_ecologique = (uint16_t*)reserver_tableau(&curseur, taille_totale * sizeof(uint16_t));
+    automate->cache_parents = (CacheParent*)reserver_tableau(&curseur, taille_totale * sizeof(CacheParent));
+    automate->cellules_mobiles = (uint32_t*)reserver_tableau(&curseur, taille_totale * sizeof(uint32_t));
+    
+    // Liste des vivantes des générations clairsemées (leurs candidates vont dans cellules_mobiles), vide au départ
+    uint32_t population_max = POPULATION_MAX_CLAIRSEMEE(automate->largeur_grille, automate->hauteur_grille);
+    automate->cellules_vivantes = (uint32_t*)reserver_tableau(&curseur, population_max * sizeof(uint32_t));
+    automate->nombre_cellules_vivantes = 0;
+    automate->mode_clairseme = 0;
+    
+    // État chaud : deux jeux de tableaux denses (génération actuelle / suivante)
+    EtatCellules *etats[2] = { &automate->etat_actuel, &automate->etat_suivant };
+    for (int i = 0; i < 2; i++) {
+        etats[i]->vivante            = reserver_tableau(&curseur, taille_totale);
+        etats[i]->age                = reserver_tableau(&curseur, taille_totale);
+        etats[i]->sante              = reserver_tableau(&curseur, taille_totale);
+        etats[i]->compteur_mouvement = reserver_tableau(&curseur, taille_totale);
+    }
+    
+    // Traits froids : un seul jeu, indexé par position
+    TraitsCellules *traits = &automate->traits;
+    traits->genotype_survie        = reserver_tableau(&curseur, taille_totale);
+    traits->genotype_naissance     = reserver_tableau(&curseur, taille_totale);
+    traits->race                   = reserver_tableau(&curseur, taille_totale);
+    traits->polarisation           = reserver_tableau(&curseur, taille_totale);
+    traits->force_polarisation     = reserver_tableau(&curseur, taille_totale);
+    traits->fitness_reproductif    = reserver_tableau(&curseur, taille_totale);
+    traits->efficacite_energetique = reserver_tableau(&curseur, taille_totale);
+    traits->espece_id              = reserver_tableau(&curseur, taille_totale);
+    traits->resistance_maladie     = reserver_tableau(&curseur, taille_totale);
+    traits->camouflage_predation   = reserver_tableau(&curseur, taille_totale);
+    traits->territorialite         = reserver_tableau(&curseur, taille_totale);
+    traits->adaptabilite_stress    = reserver_tableau(&curseur, taille_totale);
+    traits->generation_naissance   = reserver_tableau(&curseur, taille_totale);
+    
+    automate->densite_voisinage = reserver_tableau(&curseur, taille_totale);
+    
+    // Environnement : un tableau dense par facteur
+    EnvironnementCellules *environnement = &automate->environnement;
+    environnement->nutriments               = reserver_tableau(&curseur, taille_totale);
+    environnement->temperature              = reserver_tableau(&curseur, taille_totale);
+    environnement->pression_predation       = reserver_tableau(&curseur, taille_totale);
+    environnement->pathogenes_present       = reserver_tableau(&curseur, taille_totale);
+    environnement->toxicite_locale          = reserver_tableau(&curseur, taille_totale);
+    environnement->competition_territoriale = reserver_tableau(&curseur, taille_totale);
+    automate->demande_nutriments = reserver_tableau(&curseur, taille_totale);
+    
+    automate->parents_potentiels = reserver_tableau(&curseur, TAILLE_GRILLE_HALO(automate->largeur_grille,
+                                                                                 automate->hauteur_grille));
+    
+    // Tuiles d'activité : quatre octets par tuile
+    uint32_t nombre_tuiles = NOMBRE_TUILES(automate->largeur_grille, automate->hauteur_grille);
+    automate->tuiles_peuplees = reserver_tableau(&curseur, nombre_tuiles);
+    automate->tuiles_actives = reserver_tableau(&curseur, nombre_tuiles);
+    automate->tuiles_differees = reserver_tableau(&curseur, nombre_tuiles);
+    automate->nutriments_tuiles = reserver_tableau(&curseur, nombre_tuiles);
+    return zone_memoire + TAILLE_GRILLE_EVOLUTIVE(automate->largeur_grille, automate->hauteur_grille);
+}
+
+void attacher_memoire_automate(AutomateCellulaire *automate, uint8_t *zone_memoire) {
+    if (!automate || !zone_memoire) return;
+    
+    // Moteur bitboard : deux plans de bits et les bandes du blocage temporel, rien d'autre
+    if (automate->moteur == MOTEUR_BITBOARD) {
+        uint32_t taille_plan = TAILLE_PLAN_OCCUPATION(automate->largeur_grille, automate->hauteur_grille);
+        uint32_t mots_par_ligne = MOTS_PAR_LIGNE(automate->largeur_grille);
+        uint8_t *curseur = zone_memoire;
+        automate->plan_occupation = (uint32_t*)reserver_tableau(&curseur, taille_plan) + mots_par_ligne;
+        automate->plan_suivant = (uint32_t*)reserver_tableau(&curseur, taille_plan) + mots_par_ligne;
+        automate->bandes_temporelles = (uint32_t*)reserver_tableau(&curseur,
+                                                                   TAILLE_BANDES_TEMPORELLES(automate->largeur_grille));
+        return;
+    }
+    
+    // Grilles de travail du blocage temporel à la suite de la grille, si elle est assez haute
+    uint8_t *grilles_travail = reserver_grille_evolutive(automate, zone_memoire);
+    automate->grilles_travail = TAILLE_GRILLES_TRAVAIL(automate->largeur_grille, automate->hauteur_grille)
+                                ? grilles_travail : NULL;
+    preparer_champs_spatiaux(automate);
+}
+
+// Accès à un bit du plan d'occupation (ligne, colonne)
+static int lire_bit_plan(const AutomateCellulaire *automate, const uint32_t *plan, int ligne, int colonne) {
+    const uint32_t *mots = &plan[ligne * MOTS_PAR_LIGNE(automate->largeur_grille)];
+    return (mots[colonne / BITS_PAR_MOT] >> (colonne % BITS_PAR_MOT)) & 1u;
+}
+
+static void ecrire_bit_plan(const AutomateCellulaire *automate, uint32_t *plan, int ligne, int colonne, int valeur) {
+    uint32_t *mot = &plan[ligne * MOTS_PAR_LIGNE(automate->largeur_grille) + colonne / BITS_PAR_MOT];
+    uint32_t masque = 1u << (colonne % BITS_PAR_MOT);
+    *mot = valeur ? (*mot | masque) : (*mot & ~masque);
+}
+
+// Tuile d'activité contenant une position
+static uint32_t tuile_de_position(const AutomateCellulaire *automate, int position) {
+    int largeur = automate->largeur_grille;
+    return (uint32_t)(position / largeur / COTE_TUILE) * MOTS_PAR_LIGNE(largeur) +
+           (uint32_t)(position % largeur) / COTE_TUILE;
+}
+
+// Bornes d'une tuile d'activité : lignes [premiere_ligne, fin_lignes), colonnes [debut, fin)
+static void bornes_tuile(const AutomateCellulaire *automate, uint32_t tuile, int *premiere_ligne, int *fin_lignes,
+                         int *debut, int *fin) {
+    uint32_t tuiles_par_ligne = MOTS_PAR_LIGNE(automate->largeur_grille);
+    *premiere_ligne = (int)(tuile / tuiles_par_ligne * COTE_TUILE);
+    *fin_lignes = (*premiere_ligne + COTE_TUILE < automate->hauteur_grille) ? *premiere_ligne + COTE_TUILE
+                                                                           : automate->hauteur_grille;
+    *debut = (int)(tuile % tuiles_par_ligne * COTE_TUILE);
+    *fin = (*debut + COTE_TUILE < automate->largeur_grille) ? *debut + COTE_TUILE : automate->largeur_grille;
+}
+
+// Pression de prédation d'un site pour l'intensité du cycle, saturée à un octet
+static inline uint8_t calculer_pression_predation(uint16_t intensite_predation, uint16_t gradient) {
+    uint32_t pression = ((uint32_t)intensite_predation * gradient * PREDATION_PRESSURE) >> 16;
+    return (pression > 255) ? 255 : (uint8_t)pression;
+}
+
+/**
+ * Environment of a site of a deferred tile, from the tile's nutrient level and
+ * the cycles of the last generation: an empty tile has no toxicity nor
+ * competition and the sparse pathogen level; only predation varies per site
+ */
+static void lire_site_differe(const AutomateCellulaire *automate, int position, uint8_t nutriments,
+                              EnvironnementLocal *environnement) {
+    environnement->nutriments = nutriments;
+    environnement->temperature = automate->environnement.temperature[position];
+    environnement->pression_predation = calculer_pression_predation(automate->cycles.intensite_predation,
+                                                                    automate->gradient_predation[position]);
+    environnement->pathogenes_present = automate->cycles.pathogenes_clairseme;
+    environnement->toxicite_locale = 0;
+    environnement->competition_territoriale = 0;
+}
+
+// Réécrit les tableaux d'une tuile différée, qui redevient une tuile ordinaire
+static void materialiser_tuile(AutomateCellulaire *automate, uint32_t tuile) {
+    EnvironnementCellules *env = &automate->environnement;
+    int premiere_ligne, fin_lignes, debut, fin;
+    bornes_tuile(automate, tuile, &premiere_ligne, &fin_lignes, &debut, &fin);
+    
+    for (int ligne = premiere_ligne; ligne < fin_lignes; ligne++) {
+        int origine = ligne * automate->largeur_grille;
+        for (int position = origine + debut; position < origine + fin; position++) {
+            EnvironnementLocal site;
+            lire_site_differe(automate, position, automate->nutriments_tuiles[tuile], &site);
+            env->nutriments[position] = site.nutriments;
+            env->pression_predation[position] = site.pression_predation;
+            env->pathogenes_present[position] = site.pathogenes_present;
+            env->toxicite_locale[position] = site.toxicite_locale;
+            env->competition_territoriale[position] = site.competition_territoriale;
+        }
+    }
+    automate->tuiles_differees[tuile] = 0;
+}
+
+// Toutes les tuiles différées retrouvent leurs tableaux (avant de lire l'environnement en direct)
+static void materialiser_environnement(AutomateCellulaire *automate) {
+    uint32_t nombre_tuiles = NOMBRE_TUILES(automate->largeur_grille, automate->hauteur_grille);
+    for (uint32_t tuile = 0; tuile < nombre_tuiles; tuile++) {
+        if (automate->tuiles_differees[tuile]) materialiser_tuile(automate, tuile);
+    }
+}
+
+// Vrai si les tableaux du moteur choisi sont en place
+static int memoire_attachee(const AutomateCellulaire *automate) {
+    if (automate->moteur == MOTEUR_BITBOARD) return automate->plan_occupation && automate->plan_suivant;
+    return automate->etat_actuel.vivante != NULL;
+}
+
+void lire_cellule(const AutomateCellulaire *automate, int position, CelluleEvolutive *cellule) {
+    const EtatCellules *etat = &automate->etat_actuel;
+    const TraitsCellules *traits = &automate->traits;
+    
+    if (automate->moteur == MOTEUR_BITBOARD) {
+        CelluleEvolutive vide = {0};
+        *cellule = vide;
+        cellule->vivante = (uint8_t)lire_bit_plan(automate, automate->plan_occupation,
+                                                  position / automate->largeur_grille,
+                                                  position % automate->largeur_grille);
+        return;
+    }
+    
+    cellule->vivante = etat->vivante[position];
+    cellule->age = etat->age[position];
+    cellule->genotype_survie = traits->genotype_survie[position];
+    cellule->genotype_naissance = traits->genotype_naissance[position];
+    cellule->sante = etat->sante[position];
+    cellule->race = traits->race[position];
+    cellule->polarisation = traits->polarisation[position];
+    cellule->force_polarisation = traits->force_polarisation[position];
+    cellule->compteur_mouvement = etat->compteur_mouvement[position];
+    cellule->fitness_reproductif = traits->fitness_reproductif[position];
+    cellule->efficacite_energetique = traits->efficacite_energetique[position];
+    cellule->espece_id = traits->espece_id[position];
+    cellule->resistance_maladie = traits->resistance_maladie[position];
+    cellule->camouflage_predation = traits->camouflage_predation[position];
+    cellule->territorialite = traits->territorialite[position];
+    cellule->adaptabilite_stress = traits->adaptabilite_stress[position];
+    cellule->generation_naissance = traits->generation_naissance[position];
+}
+
+void ecrire_cellule(AutomateCellulaire *automate, int position, const CelluleEvolutive *cellule) {
+    EtatCellules *etat = &automate->etat_actuel;
+    TraitsCellules *traits = &automate->traits;
+    
+    if (automate->moteur == MOTEUR_BITBOARD) {
+        ecrire_bit_plan(automate, automate->plan_occupation, position / automate->largeur_grille,
+                        position % automate->largeur_grille, cellule->vivante);
+        return;
+    }
+    
+    automate->mode_clairseme = 0;  // La liste des vivantes ne suit pas les écritures directes
+    etat->vivante[position] = cellule->vivante;
+    etat->age[position] = cellule->age;
+    traits->genotype_survie[position] = cellule->genotype_survie;
+    traits->genotype_naissance[position] = cellule->genotype_naissance;
+    etat->sante[position] = cellule->sante;
+    traits->race[position] = cellule->race;
+    traits->polarisation[position] = cellule->polarisation;
+    traits->force_polarisation[position] = cellule->force_polarisation;
+    etat->compteur_mouvement[position] = cellule->compteur_mouvement;
+    traits->fitness_reproductif[position] = cellule->fitness_reproductif;
+    traits->efficacite_energetique[position] = cellule->efficacite_energetique;
+    traits->espece_id[position] = cellule->espece_id;
+    traits->resistance_maladie[position] = cellule->resistance_maladie;
+    traits->camouflage_predation[position] = cellule->camouflage_predation;
+    traits->territorialite[position] = cellule->territorialite;
+    traits->adaptabilite_stress[position] = cellule->adaptabilite_stress;
+    traits->generation_naissance[position] = cellule->generation_naissance;
+}
+
+void lire_environnement(const AutomateCellulaire *automate, int position, EnvironnementLocal *environnement) {
+    const EnvironnementCellules *env = &automate->environnement;
+    
+    uint32_t tuile = tuile_de_position(automate, position);
+    if (automate->tuiles_differees[tuile]) {
+        lire_site_differe(automate, position, automate->nutriments_tuiles[tuile], environnement);
+        return;
+    }
+    
+    environnement->nutriments = env->nutriments[position];
+    environnement->temperature = env->temperature[position];
+    environnement->pression_predation = env->pression_predation[position];
+    environnement->pathogenes_present = env->pathogenes_present[position];
+    environnement->toxicite_locale = env->toxicite_locale[position];
+    environnement->competition_territoriale = env->competition_territoriale[position];
+}
+
+void ecrire_environnement(AutomateCellulaire *automate, int position, const EnvironnementLocal *environnement) {
+    EnvironnementCellules *env = &automate->environnement;
+    
+    uint32_t tuile = tuile_de_position(automate, position);
+    if (automate->tuiles_differees[tuile]) materialiser_tuile(automate, tuile);
+    
+    env->nutriments[position] = environnement->nutriments;
+    env->temperature[position] = environnement->temperature;
+    env->pression_predation[position] = environnement->pression_predation;
+    env->pathogenes_present[position] = environnement->pathogenes_present;
+    env->toxicite_locale[position] = environnement->toxicite_locale;
+    env->competition_territoriale[position] = environnement->competition_territoriale;
+}
+
 // =============================
 // UTILITAIRES COMMUNS POUR L'INITIALISATION
 // =============================
@@ -116,53 +583,55 @@ void analyser_regles_automate(AutomateCellulaire *automate) {
 // Fonction helper pour nettoyer la grille évolutive
 static void nettoyer_grille(AutomateCellulaire *automate) {
     int taille_totale = automate->largeur_grille * automate->hauteur_grille;
+    EtatCellules *etats[2] = { &automate->etat_actuel, &automate->etat_suivant };
+    TraitsCellules *traits = &automate->traits;
+    
+    if (automate->moteur == MOTEUR_BITBOARD) {
+        uint32_t nombre_mots = (uint32_t)automate->hauteur_grille * MOTS_PAR_LIGNE(automate->largeur_grille);
+        for (uint32_t mot = 0; mot < nombre_mots; mot++) {
+            automate->plan_occupation[mot] = 0;
+            automate->plan_suivant[mot] = 0;
+        }
+        return;
+    }
     
-    // Nettoyer les cellules
     for (int i = 0; i < taille_totale; i++) {
-        automate->grille_cellules_actuelles[i].vivante = 0;
-        automate->grille_cellules_actuelles[i].age = 0;
-        automate->grille_cellules_actuelles[i].genotype_survie = 128;  // Valeur par défaut
-        automate->grille_cellules_actuelles[i].genotype_naissance = 128;
-        automate->grille_cellules_actuelles[i].sante = 0;
-        automate->grille_cellules_actuelles[i].race = RACE_EXPLORATRICE;
-        automate->grille_cellules_actuelles[i].polarisation = DIRECTION_NORD;
-        automate->grille_cellules_actuelles[i].force_polarisation = 0;
-        automate->grille_cellules_actuelles[i].compteur_mouvement = 0;
-        automate->grille_cellules_actuelles[i].fitness_reproductif = 50;
-        automate->grille_cellules_actuelles[i].efficacite_energetique = 128;
-        automate->grille_cellules_actuelles[i].espece_id = 0;
-        automate->grille_cellules_actuelles[i].resistance_maladie = 100;
-        automate->grille_cellules_actuelles[i].camouflage_predation = 100;
-        automate->grille_cellules_actuelles[i].territorialite = 100;
-        automate->grille_cellules_actuelles[i].adaptabilite_stress = 100;
-        automate->grille_cellules_actuelles[i].generation_naissance = 0;
+        // Nettoyer l'état chaud des deux générations
+        for (int e = 0; e < 2; e++) {
+            etats[e]->vivante[i] = 0;
+            etats[e]->age[i] = 0;
+            etats[e]->sante[i] = 0;
+            etats[e]->compteur_mouvement[i] = 0;
+        }
         
-        automate->grille_cellules_suivantes[i].vivante = 0;
-        automate->grille_cellules_suivantes[i].age = 0;
-        automate->grille_cellules_suivantes[i].genotype_survie = 128;
-        automate->grille_cellules_suivantes[i].genotype_naissance = 128;
-        automate->grille_cellules_suivantes[i].sante = 0;
-        automate->grille_cellules_suivantes[i].race = RACE_EXPLORATRICE;
-        automate->grille_cellules_suivantes[i].polarisation = DIRECTION_NORD;
-        automate->grille_cellules_suivantes[i].force_polarisation = 0;
-        automate->grille_cellules_suivantes[i].compteur_mouvement = 0;
-        automate->grille_cellules_suivantes[i].fitness_reproductif = 50;
-        automate->grille_cellules_suivantes[i].efficacite_energetique = 128;
-        automate->grille_cellules_suivantes[i].espece_id = 0;
-        automate->grille_cellules_suivantes[i].resistance_maladie = 100;
-        automate->grille_cellules_suivantes[i].camouflage_predation = 100;
-        automate->grille_cellules_suivantes[i].territorialite = 100;
-        automate->grille_cellules_suivantes[i].adaptabilite_stress = 100;
-        automate->grille_cellules_suivantes[i].generation_naissance = 0;
+        // Traits froids par défaut
+        traits->genotype_survie[i] = 128;  // Valeur par défaut
+        traits->genotype_naissance[i] = 128;
+        traits->race[i] = RACE_EXPLORATRICE;
+        traits->polarisation[i] = DIRECTION_NORD;
+        traits->force_polarisation[i] = 0;
+        traits->fitness_reproductif[i] = 50;
+        traits->efficacite_energetique[i] = 128;
+        traits->espece_id[i] = 0;
+        traits->resistance_maladie[i] = 100;
+        traits->camouflage_predation[i] = 100;
+        traits->territorialite[i] = 100;
+        traits->adaptabilite_stress[i] = 100;
+        traits->generation_naissance[i] = 0;
         
         // Initialiser l'environnement
-        automate->grille_environnement[i].nutriments = NUTRIMENTS_INITIAUX;
-        automate->grille_environnement[i].temperature = 128;  // Valeur neutre
-        automate->grille_environnement[i].pression_predation = 0;
-        automate->grille_environnement[i].pathogenes_present = 0;
-        automate->grille_environnement[i].toxicite_locale = 0;
-        automate->grille_environnement[i].competition_territoriale = 0;
+        automate->environnement.nutriments[i] = NUTRIMENTS_INITIAUX;
+        automate->environnement.temperature[i] = 128;  // Valeur neutre
+        automate->environnement.pression_predation[i] = 0;
+        automate->environnement.pathogenes_present[i] = 0;
+        automate->environnement.toxicite_locale[i] = 0;
+        automate->environnement.competition_territoriale[i] = 0;
     }
+    
+    // L'environnement vient d'être écrit site par site : aucune tuile différée
+    uint32_t nombre_tuiles = NOMBRE_TUILES(automate->largeur_grille, automate->hauteur_grille);
+    for (uint32_t tuile = 0; tuile < nombre_tuiles; tuile++) automate->tuiles_differees[tuile] = 0;
+    automate->mode_clairseme = 0;
 }
 
 // Fonction helper pour calculer les seuils de probabilité selon les constantes
@@ -171,19 +640,63 @@ static uint32_t calculer_seuil_probabilite(int densite_pourcentage) {
     return (0xFFFFFFFFu / 100) * densite_pourcentage;
 }
 
+// Donne vie à une cellule avec des traits aléatoires (initialisations uniforme et centrée)
+static void creer_cellule_aleatoire(AutomateCellulaire *automate, int ligne, int colonne, uint32_t *generateur_etat) {
+    int largeur = automate->largeur_grille, hauteur = automate->hauteur_grille;
+    int position = ligne * largeur + colonne;
+    EtatCellules *etat = &automate->etat_actuel;
+    TraitsCellules *traits = &automate->traits;
+    uint32_t generateur = *generateur_etat;
+    
+    // Moteur bitboard : seul l'état compte, même consommation du générateur
+    if (automate->moteur == MOTEUR_BITBOARD) {
+        ecrire_bit_plan(automate, automate->plan_occupation, ligne, colonne, 1);
+        *generateur_etat = generateur * 1103515245u + 12345u;
+        return;
+    }
+    
+    etat->vivante[position] = 1;
+    etat->age[position] = FERTILITE_DEBUT + (generateur % (FERTILITE_OPTIMALE - FERTILITE_DEBUT));
+    traits->genotype_survie[position] = 100 + (generateur % 56);
+    traits->genotype_naissance[position] = 100 + ((generateur >> 8) % 56);
+    etat->sante[position] = 50;
+    
+    // Assignation aléatoire de race et polarisation
+    traits->race[position] = (uint8_t)(generateur % NOMBRE_RACES);
+    traits->polarisation[position] = (uint8_t)((generateur >> 4) % NOMBRE_DIRECTIONS);
+    traits->force_polarisation[position] = FORCE_POLARISATION_INITIALE + (generateur % 64);
+    etat->compteur_mouvement[position] = generateur % RYTHME_MOUVEMENT_LENT;
+    
+    // Initialisation des traits évolutifs
+    traits->fitness_reproductif[position] = 30 + (generateur % 40);  // 30-70
+    traits->efficacite_energetique[position] = 80 + (generateur % 80);  // 80-160
+    traits->espece_id[position] = determiner_espece(NULL, 0, colonne, ligne, largeur, hauteur);
+    
+    // Initialisation des traits biologiques réalistes (variations naturelles)
+    generateur = generateur * 1103515245u + 12345u;
+    traits->resistance_maladie[position] = 80 + (generateur % 50);  // 80-130
+    traits->camouflage_predation[position] = 70 + ((generateur >> 8) % 60);  // 70-130
+    traits->territorialite[position] = 60 + ((generateur >> 16) % 70);  // 60-130
+    traits->adaptabilite_stress[position] = 85 + ((generateur >> 24) % 40);  // 85-125
+    traits->generation_naissance[position] = 0;  // Génération initiale
+    
+    *generateur_etat = generateur;
+}
+
 // =============================
 // FONCTIONS D'INITIALISATION MODULAIRES
 // =============================
 
 // Distribution uniforme simple
 void initialiser_grille_uniforme(AutomateCellulaire *automate, uint32_t graine_aleatoire) {
-    if (!automate || !automate->grille_cellules_actuelles) return;
+    if (!automate || !memoire_attachee(automate)) return;
     
     uint32_t generateur = (graine_aleatoire != 0) ? graine_aleatoire : 0x12345678;
     int largeur = automate->largeur_grille;
     int hauteur = automate->hauteur_grille;
     
     nettoyer_grille(automate);
+    automate->graine_aleatoire = graine_aleatoire;  // Clé des tirages des générations suivantes
     
     // Densité fixe au milieu de la plage configurée
     int densite = (DENSITE_MINIMUM + DENSITE_MAXIMUM) / 2;
@@ -193,31 +706,7 @@ void initialiser_grille_uniforme(AutomateCellulaire *automate, uint32_t graine_a
         for (int colonne = 0; colonne < largeur; colonne++) {
             generateur = generateur * 1103515245u + 12345u;
             if (generateur < seuil) {
-                CelluleEvolutive* cellule = &automate->grille_cellules_actuelles[ligne * largeur + colonne];
-                cellule->vivante = 1;
-                cellule->age = FERTILITE_DEBUT + (generateur % (FERTILITE_OPTIMALE - FERTILITE_DEBUT));
-                cellule->genotype_survie = 100 + (generateur % 56);
-                cellule->genotype_naissance = 100 + ((generateur >> 8) % 56);
-                cellule->sante = 50;
-                
-                // Assignation aléatoire de race et polarisation
-                cellule->race = (RaceCellule)(generateur % NOMBRE_RACES);
-                cellule->polarisation = (DirectionPolarisation)((generateur >> 4) % NOMBRE_DIRECTIONS);
-                cellule->force_polarisation = FORCE_POLARISATION_INITIALE + (generateur % 64);
-                cellule->compteur_mouvement = generateur % RYTHME_MOUVEMENT_LENT;
-                
-                // Initialisation des traits évolutifs
-                cellule->fitness_reproductif = 30 + (generateur % 40);  // 30-70
-                cellule->efficacite_energetique = 80 + (generateur % 80);  // 80-160
-                cellule->espece_id = determiner_espece(NULL, 0, colonne, ligne, largeur, hauteur);
-                
-                // Initialisation des traits biologiques réalistes (variations naturelles)
-                generateur = generateur * 1103515245u + 12345u;
-                cellule->resistance_maladie = 80 + (generateur % 50);  // 80-130
-                cellule->camouflage_predation = 70 + ((generateur >> 8) % 60);  // 70-130
-                cellule->territorialite = 60 + ((generateur >> 16) % 70);  // 60-130
-                cellule->adaptabilite_stress = 85 + ((generateur >> 24) % 40);  // 85-125
-                cellule->generation_naissance = 0;  // Génération initiale
+                creer_cellule_aleatoire(automate, ligne, colonne, &generateur);
             }
         }
     }
@@ -225,13 +714,14 @@ void initialiser_grille_uniforme(AutomateCellulaire *automate, uint32_t graine_a
 
 // Distribution plus dense au centre
 void initialiser_grille_centre(AutomateCellulaire *automate, uint32_t graine_aleatoire) {
-    if (!automate || !automate->grille_cellules_actuelles) return;
+    if (!automate || !memoire_attachee(automate)) return;
     
     uint32_t generateur = (graine_aleatoire != 0) ? graine_aleatoire : 0x12345678;
     int largeur = automate->largeur_grille;
     int hauteur = automate->hauteur_grille;
     
     nettoyer_grille(automate);
+    automate->graine_aleatoire = graine_aleatoire;
     
     for (int ligne = 0; ligne < hauteur; ligne++) {
         for (int colonne = 0; colonne < largeur; colonne++) {
@@ -247,31 +737,7 @@ void initialiser_grille_centre(AutomateCellulaire *automate, uint32_t graine_ale
             uint32_t seuil = calculer_seuil_probabilite(densite);
             
             if (generateur < seuil) {
-                CelluleEvolutive* cellule = &automate->grille_cellules_actuelles[ligne * largeur + colonne];
-                cellule->vivante = 1;
-                cellule->age = FERTILITE_DEBUT + (generateur % (FERTILITE_OPTIMALE - FERTILITE_DEBUT));
-                cellule->genotype_survie = 100 + (generateur % 56);
-                cellule->genotype_naissance = 100 + ((generateur >> 8) % 56);
-                cellule->sante = 50;
-                
-                // Assignation aléatoire de race et polarisation
-                cellule->race = (RaceCellule)(generateur % NOMBRE_RACES);
-                cellule->polarisation = (DirectionPolarisation)((generateur >> 4) % NOMBRE_DIRECTIONS);
-                cellule->force_polarisation = FORCE_POLARISATION_INITIALE + (generateur % 64);
-                cellule->compteur_mouvement = generateur % RYTHME_MOUVEMENT_LENT;
-                
-                // Initialisation des traits évolutifs
-                cellule->fitness_reproductif = 30 + (generateur % 40);  // 30-70
-                cellule->efficacite_energetique = 80 + (generateur % 80);  // 80-160
-                cellule->espece_id = determiner_espece(NULL, 0, colonne, ligne, largeur, hauteur);
-                
-                // Initialisation des traits biologiques réalistes (variations naturelles)
-                generateur = generateur * 1103515245u + 12345u;
-                cellule->resistance_maladie = 80 + (generateur % 50);  // 80-130
-                cellule->camouflage_predation = 70 + ((generateur >> 8) % 60);  // 70-130
-                cellule->territorialite = 60 + ((generateur >> 16) % 70);  // 60-130
-                cellule->adaptabilite_stress = 85 + ((generateur >> 24) % 40);  // 85-125
-                cellule->generation_naissance = 0;  // Génération initiale
+                creer_cellule_aleatoire(automate, ligne, colonne, &generateur);
             }
         }
     }
@@ -279,14 +745,17 @@ void initialiser_grille_centre(AutomateCellulaire *automate, uint32_t graine_ale
 
 // Distribution avec clustering naturel (version actuelle améliorée)
 void initialiser_grille_clusters(AutomateCellulaire *automate, uint32_t graine_aleatoire) {
-    if (!automate || !automate->grille_cellules_actuelles) return;
+    if (!automate || !memoire_attachee(automate)) return;
     
     uint32_t generateur_1 = (graine_aleatoire != 0) ? graine_aleatoire : 0x12345678;
     uint32_t generateur_2 = generateur_1 ^ 0x9ABCDEF0;
     int largeur = automate->largeur_grille;
     int hauteur = automate->hauteur_grille;
+    EtatCellules *etat = &automate->etat_actuel;
+    TraitsCellules *traits = &automate->traits;
     
     nettoyer_grille(automate);
+    automate->graine_aleatoire = graine_aleatoire;
     
     // Utilise les constantes configurables
     uint32_t seuil_base = calculer_seuil_probabilite(DENSITE_MINIMUM);
@@ -312,7 +781,10 @@ void initialiser_grille_clusters(AutomateCellulaire *automate, uint32_t graine_a
                     if (dx == 0 && dy == 0) continue;
                     int vx = colonne + dx, vy = ligne + dy;
                     if (vx >= 0 && vx < largeur && vy >= 0 && vy < hauteur) {
-                        if (automate->grille_cellules_actuelles[vy * largeur + vx].vivante == 1) {
+                        int vivante = (automate->moteur == MOTEUR_BITBOARD) ?
+                                      lire_bit_plan(automate, automate->plan_occupation, vy, vx) :
+                                      etat->vivante[vy * largeur + vx];
+                        if (vivante == 1) {
                             voisins_vivants++;
                         }
                     }
@@ -324,13 +796,15 @@ void initialiser_grille_clusters(AutomateCellulaire *automate, uint32_t graine_a
             }
             
             uint32_t valeur_combinee = (generateur_1 ^ (generateur_2 >> 3)) + (ligne * 7 + colonne * 11);
-            if (valeur_combinee < seuil_probabilite) {
-                CelluleEvolutive* cellule = &automate->grille_cellules_actuelles[ligne * largeur + colonne];
-                cellule->vivante = 1;
-                cellule->age = FERTILITE_DEBUT + (generateur_1 % (FERTILITE_OPTIMALE - FERTILITE_DEBUT));
-                cellule->genotype_survie = 100 + (generateur_1 % 56);
-                cellule->genotype_naissance = 100 + ((generateur_2 >> 8) % 56);
-                cellule->sante = 50;
+            if (valeur_combinee < seuil_probabilite && automate->moteur == MOTEUR_BITBOARD) {
+                ecrire_bit_plan(automate, automate->plan_occupation, ligne, colonne, 1);
+            } else if (valeur_combinee < seuil_probabilite) {
+                int position = ligne * largeur + colonne;
+                etat->vivante[position] = 1;
+                etat->age[position] = FERTILITE_DEBUT + (generateur_1 % (FERTILITE_OPTIMALE - FERTILITE_DEBUT));
+                traits->genotype_survie[position] = 100 + (generateur_1 % 56);
+                traits->genotype_naissance[position] = 100 + ((generateur_2 >> 8) % 56);
+                etat->sante[position] = 50;
             }
         }
     }
@@ -367,51 +841,54 @@ void initialiser_grille_aleatoire(AutomateCellulaire *automate, uint32_t graine_
 // FONCTIONS ÉVOLUTIVES BIOLOGIQUES
 // =============================
 
-// Calcule le fitness reproductif selon la théorie de l'évolution adaptative
-static uint8_t calculer_fitness_evolutif(CelluleEvolutive* cellule, int position_x, int position_y, 
-                                        uint32_t generation, int largeur, int hauteur) {
-    // Fitness de base selon l'âge optimal (courbe en cloche)
-    float fitness_age = calculer_fertilite(cellule->age);
-    
-    // Cycle énergétique sinusoïdal créant une pression de sélection variable
-    float phase_environnementale = 2.0f * 3.14159f * generation / CYCLES_ENVIRONNEMENTAUX;
-    float coefficient_energetique = 1.0f + 0.3f * simple_sin(phase_environnementale);
-    
-    // Fitness spatial : avantage selon la position (niches écologiques)
-    float distance_centre_x = 2.0f * (float)position_x / largeur - 1.0f;  // -1 à 1
-    float distance_centre_y = 2.0f * (float)position_y / hauteur - 1.0f;  // -1 à 1
-    float niche_factor = 1.0f - 0.3f * (distance_centre_x * distance_centre_x + distance_centre_y * distance_centre_y);
+/**
+ * Fills the parent cache of a fertile live cell: every fitness term that does
+ * not depend on the child's position, with the same Q8 rounding steps as the
+ * full product (fertility x energy coefficient first)
+ */
+static void preparer_cache_parent(const AutomateCellulaire *automate, uint32_t position_parent,
+                                  uint32_t fertilite, CacheParent *parent) {
+    uint32_t coefficient_energetique = automate->cycles.coefficient_energetique;
+    uint32_t efficacite = automate->traits.efficacite_energetique[position_parent];
     
+    parent->fertilite = (uint16_t)fertilite;
+    parent->fitness_base = (uint16_t)((FITNESS_AMPLITUDE * fertilite * coefficient_energetique) >> 8);
+    // Efficacité énergétique : utilisation optimale des ressources (0.25 x efficacité / 256 x coefficient)
+    parent->bonus_efficacite = (uint16_t)(256 + ((efficacite * coefficient_energetique) >> 10));
+    parent->race = automate->traits.race[position_parent];
+}
+
+// Calcule le fitness reproductif selon la théorie de l'évolution adaptative
+// à partir du cache du parent et de la niche écologique de l'enfant
+static uint8_t calculer_fitness_evolutif(const CyclesGeneration *cycles, const CacheParent *parent,
+                                        uint32_t niche_factor) {
     // Fitness racial : spécialisations évolutives
-    float bonus_racial = 1.0f;
-    switch (cellule->race) {
+    uint32_t bonus_racial = 256;
+    switch (parent->race) {
         case RACE_EXPLORATRICE:
-            bonus_racial = 1.0f + 0.2f * (1.0f - niche_factor);  // Avantage en périphérie
+            bonus_racial = 256 + ((Q8(0.2) * (256 - niche_factor)) >> 8);  // Avantage en périphérie
             break;
         case RACE_COLONISATRICE: 
-            bonus_racial = 1.0f + 0.2f * niche_factor;  // Avantage au centre
+            bonus_racial = 256 + ((Q8(0.2) * niche_factor) >> 8);  // Avantage au centre
             break;
         case RACE_NOMADE:
-            bonus_racial = 1.0f + 0.1f * coefficient_energetique;  // Avantage lors de cycles favorables
+            bonus_racial = cycles->bonus_nomade;
             break;
         case RACE_ADAPTATIVE:
-            bonus_racial = 1.0f + 0.15f * simple_abs(simple_sin(phase_environnementale * 2.0f));  // Avantage lors de changements
+            bonus_racial = cycles->bonus_adaptatif;
             break;
         case NOMBRE_RACES:
         default:
-            bonus_racial = 1.0f;
+            bonus_racial = 256;
             break;
     }
     
-    // Efficacité énergétique : utilisation optimale des ressources
-    float efficacite = (float)cellule->efficacite_energetique / 255.0f;
-    float bonus_efficacite = 1.0f + 0.25f * efficacite * coefficient_energetique;
-    
-    // Calcul final du fitness (0-255)
-    float fitness_total = FITNESS_AMPLITUDE * fitness_age * coefficient_energetique * 
-                         niche_factor * bonus_racial * bonus_efficacite;
+    // Calcul final du fitness (0-255) : produit de facteurs Q8, renormalisé à chaque étape
+    uint32_t fitness_total = (parent->fitness_base * niche_factor) >> 8;
+    fitness_total = (fitness_total * bonus_racial) >> 8;
+    fitness_total = (fitness_total * parent->bonus_efficacite) >> 16;
     
-    return (fitness_total > 255.0f) ? 255 : (uint8_t)fitness_total;
+    return (fitness_total > 255) ? 255 : (uint8_t)fitness_total;
 }
 
 // Calcule la distance génétique entre deux cellules pour la spéciation (réservé pour extensions futures)
@@ -427,19 +904,19 @@ static uint8_t calculer_distance_genetique(CelluleEvolutive* cellule1, CelluleEv
 */
 
 // Détermine l'espèce selon la distance génétique et l'environnement local
-static uint8_t determiner_espece(CelluleEvolutive* parents[], int nombre_parents, 
+static uint8_t determiner_espece(const uint32_t positions_parents[], int nombre_parents, 
                                 int position_x, int position_y, int largeur, int hauteur) {
     if (nombre_parents == 0) return 0;
     
-    // Espèce basée sur la niche écologique spatiale
-    float ratio_x = (float)position_x / largeur;
-    float ratio_y = (float)position_y / hauteur;
+    // Espèce basée sur la niche écologique spatiale (moitié ouest / nord de la grille)
+    int ouest = (2 * position_x < largeur);
+    int nord = (2 * position_y < hauteur);
     
     // 4 zones écologiques principales créant une pression de spéciation
-    if (ratio_x < 0.5f && ratio_y < 0.5f) return 1;      // Nord-Ouest
-    else if (ratio_x >= 0.5f && ratio_y < 0.5f) return 2;  // Nord-Est  
-    else if (ratio_x < 0.5f && ratio_y >= 0.5f) return 3;  // Sud-Ouest
-    else return 4;                                        // Sud-Est
+    if (ouest && nord) return 1;        // Nord-Ouest
+    else if (!ouest && nord) return 2;  // Nord-Est  
+    else if (ouest && !nord) return 3;  // Sud-Ouest
+    else return 4;                      // Sud-Est
 }
 
 // Obtient les coordonnées d'une direction relative
@@ -458,631 +935,2575 @@ static void obtenir_coordonnees_direction(DirectionPolarisation direction, int*
 }
 
 // Détermine si une cellule doit bouger selon sa race et ses paramètres
-static int doit_se_deplacer(CelluleEvolutive* cellule, int nombre_voisins) {
-    switch (cellule->race) {
+static int doit_se_deplacer(uint8_t race, uint8_t compteur_mouvement, int nombre_voisins) {
+    switch (race) {
         case RACE_EXPLORATRICE:
             // Se déplace plus souvent quand il y a peu de voisins
-            return (nombre_voisins <= 2) && (cellule->compteur_mouvement % RYTHME_MOUVEMENT_RAPIDE == 0);
+            return (nombre_voisins <= 2) && (compteur_mouvement % RYTHME_MOUVEMENT_RAPIDE == 0);
             
         case RACE_COLONISATRICE:
             // Se déplace rarement, préfère rester en groupe
-            return (nombre_voisins == 0) && (cellule->compteur_mouvement % RYTHME_MOUVEMENT_LENT == 0);
+            return (nombre_voisins == 0) && (compteur_mouvement % RYTHME_MOUVEMENT_LENT == 0);
             
         case RACE_NOMADE:
             // Se déplace constamment
-            return (cellule->compteur_mouvement % RYTHME_MOUVEMENT_RAPIDE == 0);
+            return (compteur_mouvement % RYTHME_MOUVEMENT_RAPIDE == 0);
             
         case RACE_ADAPTATIVE:
             // Se déplace selon les conditions : fuit la surpopulation, cherche les zones moyennement peuplées
             return (nombre_voisins > 4 || nombre_voisins == 0) && 
-                   (cellule->compteur_mouvement % (RYTHME_MOUVEMENT_RAPIDE + 1) == 0);
+                   (compteur_mouvement % (RYTHME_MOUVEMENT_RAPIDE + 1) == 0);
             
         default:
             return 0;
     }
 }
 
-// Calcule la fertilité d'une cellule selon son âge
-static float calculer_fertilite(uint8_t age) {
-    if (age < FERTILITE_DEBUT) return 0.0f;
-    if (age >= AGE_MAXIMUM) return 0.0f;
+/**
+ * Sums the inherited traits of the fertile parents in one pass: each parent's
+ * traits are read together, once, whatever the number of traits the child takes
+ */
+static void sommer_traits_parents(const AutomateCellulaire *automate, const uint32_t positions_parents[],
+                                  int nombre_parents, SommesHeritees *sommes) {
+    const TraitsCellules *traits = &automate->traits;
+    const uint8_t *ages = automate->etat_actuel.age;
+    uint8_t race_dominante = traits->race[positions_parents[0]];
+    SommesHeritees total = { .race_dominante = race_dominante };
     
-    if (age <= FERTILITE_OPTIMALE) {
-        // Montée progressive de 0 à 1
-        return (float)(age - FERTILITE_DEBUT) / (FERTILITE_OPTIMALE - FERTILITE_DEBUT);
-    } else if (age <= FERTILITE_DECLIN) {
-        // Plateau optimal
-        return 1.0f;
-    } else {
-        // Déclin progressif
-        return 1.0f - (float)(age - FERTILITE_DECLIN) / (AGE_MAXIMUM - FERTILITE_DECLIN);
+    for (int i = 0; i < nombre_parents; i++) {
+        uint32_t parent = positions_parents[i];
+        total.age += ages[parent];
+        total.polarisation += traits->polarisation[parent];
+        total.fitness_reproductif += traits->fitness_reproductif[parent];
+        total.efficacite_energetique += traits->efficacite_energetique[parent];
+        total.resistance_maladie += traits->resistance_maladie[parent];
+        total.camouflage_predation += traits->camouflage_predation[parent];
+        total.genotype_survie += traits->genotype_survie[parent];
+        total.genotype_naissance += traits->genotype_naissance[parent];
+        total.mixite |= (traits->race[parent] != race_dominante);
     }
+    *sommes = total;
 }
 
 // Calcule la race héritée avec possibilité de mixité génétique
-static RaceCellule calculer_race_herite(CelluleEvolutive* parents[], int nombre_parents, uint32_t* generateur) {
+static RaceCellule calculer_race_herite(const SommesHeritees *sommes, int nombre_parents, FluxAleatoire *flux) {
     if (nombre_parents == 0) return RACE_EXPLORATRICE;
     
-    // Vérifier s'il y a mixité génétique (différentes races parmi les parents)
-    RaceCellule race_dominante = parents[0]->race;
-    int mixite_presente = 0;
-    
-    for (int i = 1; i < nombre_parents; i++) {
-        if (parents[i]->race != race_dominante) {
-            mixite_presente = 1;
-            break;
-        }
-    }
+    // Mixité génétique : différentes races parmi les parents
+    RaceCellule race_dominante = (RaceCellule)sommes->race_dominante;
+    int mixite_presente = sommes->mixite;
     
-    *generateur = *generateur * 1103515245u + 12345u;
+    uint32_t generateur = tirer_flux(flux);
     
-    if (mixite_presente && ((*generateur % 100) < MIXITE_GENETIQUE_CHANCE)) {
+    uint32_t tirage = tirer_borne(TIRAGE_PRINCIPAL(generateur), 100);
+    if (mixite_presente && (tirage < MIXITE_GENETIQUE_CHANCE)) {
         // Création d'une race hybride adaptative
         return RACE_ADAPTATIVE;
-    } else if ((*generateur % 100) < HERITAGE_RACE_PROBABILITE) {
+    } else if (tirage < HERITAGE_RACE_PROBABILITE) {
         // Héritage normal de la race dominante
         return race_dominante;
     } else {
         // Mutation vers une race aléatoire
-        return (RaceCellule)((*generateur >> 8) % NOMBRE_RACES);
+        return (RaceCellule)tirer_borne(TIRAGE_SECONDAIRE(generateur), NOMBRE_RACES);
     }
 }
 
 // Calcule la polarisation héritée avec variations
-static DirectionPolarisation calculer_polarisation_herite(CelluleEvolutive* parents[], int nombre_parents, uint32_t* generateur) {
+static DirectionPolarisation calculer_polarisation_herite(const SommesHeritees *sommes, int nombre_parents,
+                                                          FluxAleatoire *flux) {
     if (nombre_parents == 0) return DIRECTION_NORD;
     
     // Moyenne des polarisations parentales avec variation
-    int somme_directions = 0;
-    for (int i = 0; i < nombre_parents; i++) {
-        somme_directions += parents[i]->polarisation;
-    }
-    int direction_moyenne = somme_directions / nombre_parents;
+    int direction_moyenne = (int)diviser_petit(sommes->polarisation, nombre_parents);
     
     // Variation génétique de la direction
-    *generateur = *generateur * 1103515245u + 12345u;
-    int variation = ((*generateur % 5) - 2);  // -2 à +2
+    int variation = (int)tirer_borne(TIRAGE_PRINCIPAL(tirer_flux(flux)), 5) - 2;  // -2 à +2
     direction_moyenne = (direction_moyenne + variation + NOMBRE_DIRECTIONS) % NOMBRE_DIRECTIONS;
     
     return (DirectionPolarisation)direction_moyenne;
 }
 
 // Calcule l'âge initial d'une cellule née de plusieurs parents
-static uint8_t calculer_age_herite(CelluleEvolutive* parents[], int nombre_parents, uint32_t* generateur) {
+static uint8_t calculer_age_herite(const SommesHeritees *sommes, int nombre_parents, FluxAleatoire *flux) {
     if (nombre_parents == 0) return 0;
     
     // Moyenne des âges parentaux
-    uint32_t somme_ages = 0;
-    for (int i = 0; i < nombre_parents; i++) {
-        somme_ages += parents[i]->age;
-    }
-    uint32_t age_moyen_parents = somme_ages / nombre_parents;
+    uint32_t age_moyen_parents = diviser_petit(sommes->age, nombre_parents);
     
     // Héritage partiel selon facteur génétique
     uint32_t age_herite = (age_moyen_parents * FACTEUR_HEREDITE) / 100;
     
     // Mutation génétique (variation aléatoire)
-    *generateur = *generateur * 1103515245u + 12345u;
-    if ((*generateur % 100) < TAUX_MUTATION) {
-        int mutation = ((*generateur >> 8) % (2 * VARIATION_MUTATION + 1)) - VARIATION_MUTATION;
+    uint32_t generateur = tirer_flux(flux);
+    if (tirer_borne(TIRAGE_PRINCIPAL(generateur), 100) < TAUX_MUTATION) {
+        int mutation = (int)tirer_borne(TIRAGE_SECONDAIRE(generateur), 2 * VARIATION_MUTATION + 1) - VARIATION_MUTATION;
         age_herite = (age_herite + mutation < 0) ? 0 : age_herite + mutation;
     }
     
     return (age_herite > 255) ? 255 : (uint8_t)age_herite;
 }
 
+// =============================
+// NOYAUX VECTORIELS (SSE2)
+// =============================
+
+#if defined(__i386__) || defined(__x86_64__)
+#define SSE2_COMPILABLE 1
+#else
+#define SSE2_COMPILABLE 0
+#endif
+
+#if SSE2_COMPILABLE
+// Le noyau i386 est compilé sans SSE : seules ces fonctions en émettent,
+// et elles ne sont appelées qu'une fois le noyau SSE2 sélectionné
+#define NOYAU_SSE2 __attribute__((target("sse2")))
+
+// 16 octets / 8 mots de 16 bits ; les variantes _u lisent et écrivent sans
+// alignement (les tableaux de l'arène se suivent sans bourrage)
+typedef uint8_t octets_x16 __attribute__((vector_size(16)));
+typedef char signes_x16 __attribute__((vector_size(16)));
+typedef short mots_x8 __attribute__((vector_size(16)));
+typedef uint8_t octets_x16_u __attribute__((vector_size(16), aligned(1), may_alias));
+typedef char signes_x16_u __attribute__((vector_size(16), aligned(1), may_alias));
+typedef short mots_x8_u __attribute__((vector_size(16), aligned(1), may_alias));
+#endif
+
+// SSE2 fait partie de l'ABI x86-64 ; ailleurs il faut que kmain l'ait activé
+#if defined(__x86_64__)
+static int noyau_sse2_actif = 1;
+#else
+static int noyau_sse2_actif = 0;
+#endif
+
+uint32_t lire_capacites_processeur(void) {
+#if SSE2_COMPILABLE
+#if defined(__i386__)
+    // Avant le Pentium, CPUID n'existe pas : le bit ID d'EFLAGS ne bascule alors pas
+    uint32_t avant, apres;
+    __asm__ volatile ("pushfl\n\t"
+                      "pushfl\n\t"
+                      "popl %0\n\t"
+                      "movl %0, %1\n\t"
+                      "xorl $0x200000, %1\n\t"
+                      "pushl %1\n\t"
+                      "popfl\n\t"
+                      "pushfl\n\t"
+                      "popl %1\n\t"
+                      "popfl"
+                      : "=&r"(avant), "=&r"(apres) : : "cc");
+    if (((avant ^ apres) & 0x200000u) == 0) return 0;
+#endif
+    uint32_t eax = 1, ebx, ecx = 0, edx;
+    __asm__ volatile ("cpuid" : "+a"(eax), "=b"(ebx), "+c"(ecx), "=d"(edx));
+    (void)ebx;
+    return edx;
+#else
+    return 0;
+#endif
+}
+
+int selectionner_noyau_sse2(int demande) {
+    noyau_sse2_actif = (demande && (lire_capacites_processeur() & CPUID_SSE2)) ? 1 : 0;
+    return noyau_sse2_actif;
+}
 
+#if SSE2_COMPILABLE
 /**
- * Updates environmental factors with realistic biological cycles
- * Implements predation, disease, food scarcity, and territorial pressure
+ * Unpacks the bit-sliced 3x3 sums of one full word (32 cells) into 32 bytes
+ * Each 16-bit half is broadcast to every word lane: byte 2j tests bit j of the
+ * low byte (cell j), byte 2j + 1 bit j of the high byte (cell 8 + j). The four
+ * bit planes are folded from the high one down (total = 2 x total + bit), then
+ * a pack puts the even bytes before the odd ones
  */
-static void mettre_a_jour_environnement(AutomateCellulaire *automate) {
-    int largeur = automate->largeur_grille;
-    int hauteur = automate->hauteur_grille;
-    uint32_t generation = automate->generation_actuelle;
-    
-    // Calculate global environmental factors
-    float disponibilite_nourriture = calculer_disponibilite_nourriture(generation);
+NOYAU_SSE2 static void etaler_sommes_sse2(const uint32_t somme[4], uint8_t *densites) {
+    const octets_x16 selection = { 1, 1, 2, 2, 4, 4, 8, 8, 16, 16, 32, 32, 64, 64, 128, 128 };
     
-    for (int ligne = 0; ligne < hauteur; ligne++) {
-        for (int colonne = 0; colonne < largeur; colonne++) {
-            int position = ligne * largeur + colonne;
-            EnvironnementLocal* env = &automate->grille_environnement[position];
-            
-            // Count local population density for realistic environmental pressure
-            int densite_locale = 0;
-            for (int dy = -1; dy <= 1; dy++) {
-                for (int dx = -1; dx <= 1; dx++) {
-                    int vx = (colonne + dx + largeur) % largeur;
-                    int vy = (ligne + dy + hauteur) % hauteur;
-                    if (automate->grille_cellules_actuelles[vy * largeur + vx].vivante) {
-                        densite_locale++;
-                    }
-                }
-            }
-            
-            // Update nutrient availability based on seasonal cycles
-            int nutriments_max = (int)(NUTRIMENTS_INITIAUX * disponibilite_nourriture);
-            if (env->nutriments < nutriments_max) {
-                env->nutriments += REGENERATION_NUTRIMENTS;
-                if (env->nutriments > nutriments_max) {
-                    env->nutriments = nutriments_max;
-                }
-            } else if (env->nutriments > nutriments_max) {
-                env->nutriments -= 1;  // Gradual decrease during scarcity
-            }
-            
-            // Update predation pressure (realistic predator-prey dynamics)
-            env->pression_predation = calculer_pression_predation(generation, colonne, ligne, largeur, hauteur);
-            
-            // Update disease presence (epidemiological modeling)
-            env->pathogenes_present = calculer_pathogenes(generation, densite_locale);
-            
-            // Territorial competition increases with local density
-            env->competition_territoriale = (densite_locale > MIGRATION_PRESSURE_THRESHOLD) ? 
-                                          (densite_locale * TERRITORIAL_COMPETITION) : 0;
-            
-            // Environmental toxicity (pollution from overcrowding)
-            if (densite_locale > 6) {
-                env->toxicite_locale = (densite_locale - 6) * 20;
-            } else {
-                env->toxicite_locale = (env->toxicite_locale > 0) ? env->toxicite_locale - 5 : 0;
-            }
+    for (int moitie = 0; moitie < 2; moitie++) {
+        octets_x16 total = { 0 };
+        for (int plan = 3; plan >= 0; plan--) {
+            mots_x8 diffuse = (mots_x8){ 0 } + (short)(somme[plan] >> (16 * moitie));
+            octets_x16 present = (octets_x16)(((octets_x16)diffuse & selection) == selection);  // 0xFF si le bit est à 1
+            total = total + total - present;
         }
+        mots_x8 paires = (mots_x8)total;
+        *(signes_x16_u*)&densites[16 * moitie] = __builtin_ia32_packuswb128(paires & 0xFF, paires >> 8);
     }
 }
 
 /**
- * Calculates next generation with advanced biological realism
- * 
- * This function implements a comprehensive evolutionary simulation including:
- * - Realistic predator-prey dynamics with spatial gradients
- * - Epidemic disease spread and resistance evolution
- * - Environmental stress adaptation and mutation
- * - Seasonal resource cycles and territorial competition
- * - Multi-trait inheritance with stress-adaptive mutation rates
- * 
- * @param automate Pointer to the cellular automaton structure
- * @note This function prevents evolutionary stagnation through realistic biological pressures
+ * Environment update of the sites [debut, debut + 16 x k) within [debut, fin),
+ * 16 per instruction; same arithmetic as the scalar loop, comparisons turned into lane masks
+ * The predation pressure (intensity x PREDATION_PRESSURE x gradient) >> 16 is a
+ * high-half 16-bit product, saturated to a byte by the final pack
+ * Returns the first site left to the scalar loop
  */
-void calculer_generation_suivante(AutomateCellulaire *automate) {
-    // Safety checks
-    if (!automate || !automate->grille_cellules_actuelles || !automate->grille_cellules_suivantes) return;
+NOYAU_SSE2 static int mettre_a_jour_environnement_sse2(AutomateCellulaire *automate, int debut, int fin,
+                                                       int nutriments_max) {
+    const CyclesGeneration *cycles = &automate->cycles;
+    EnvironnementCellules *env = &automate->environnement;
+    const uint8_t *densites = automate->densite_voisinage;
+    const uint16_t *gradient = automate->gradient_predation;
     
-    int largeur = automate->largeur_grille, hauteur = automate->hauteur_grille;
-    uint32_t generateur = automate->generation_actuelle * 0x9E3779B9;  // Graine basée sur génération
-    automate->population_totale = 0;
+    // Le produit doit rester sous 2^15 pour que le pack signé sature comme le code scalaire
+    uint32_t facteur_predation = (uint32_t)cycles->intensite_predation * PREDATION_PRESSURE;
+    if (facteur_predation > 0x7FFFu) return debut;
     
-    // 1) Mettre à jour l'environnement
-    mettre_a_jour_environnement(automate);
+    octets_x16 maximum = (octets_x16){ 0 } + (uint8_t)nutriments_max;
+    mots_x8 facteur = (mots_x8){ 0 } + (short)facteur_predation;
+    octets_x16 dense = (octets_x16){ 0 } + cycles->pathogenes_dense;
+    octets_x16 clairseme = (octets_x16){ 0 } + cycles->pathogenes_clairseme;
     
-    // 2) Calculer le nouvel état pour chaque cellule
-    for (int ligne = 0; ligne < hauteur; ligne++) {
-        for (int colonne = 0; colonne < largeur; colonne++) {
-            int position_cellule = ligne * largeur + colonne;
-            CelluleEvolutive* cellule_actuelle = &automate->grille_cellules_actuelles[position_cellule];
-            CelluleEvolutive* cellule_suivante = &automate->grille_cellules_suivantes[position_cellule];
-            EnvironnementLocal* environnement = &automate->grille_environnement[position_cellule];
-            
-            // Initialiser la cellule suivante comme morte
-            cellule_suivante->vivante = 0;
-            cellule_suivante->age = 0;
-            cellule_suivante->genotype_survie = 0;
-            cellule_suivante->genotype_naissance = 0;
-            cellule_suivante->sante = 0;
-            
-            // Collecter les voisins vivants et leurs propriétés
-            CelluleEvolutive* voisins_parents[8];
-            int nombre_voisins_vivants = 0;
-            int nombre_parents_fertiles = 0;
-            
-            for (int decalage_ligne = -1; decalage_ligne <= 1; decalage_ligne++) {
-                for (int decalage_colonne = -1; decalage_colonne <= 1; decalage_colonne++) {
-                    if (decalage_ligne == 0 && decalage_colonne == 0) continue;
-                    
-                    int ligne_voisin = (ligne + decalage_ligne + hauteur) % hauteur;
-                    int colonne_voisin = (colonne + decalage_colonne + largeur) % largeur;
-                    CelluleEvolutive* voisin = &automate->grille_cellules_actuelles[ligne_voisin * largeur + colonne_voisin];
-                    
-                    if (voisin->vivante) {
-                        nombre_voisins_vivants++;
-                        
-                        // Vérifier la fertilité du voisin (seuil plus permissif)
-                        float fertilite = calculer_fertilite(voisin->age);
-                        if (fertilite > 0.1f && nombre_parents_fertiles < 8) {  // Seuil réduit
-                            voisins_parents[nombre_parents_fertiles] = voisin;
-                            nombre_parents_fertiles++;
-                        }
-                    }
-                }
-            }
-            
-            if (cellule_actuelle->vivante) {
-                // ===== CELLULE VIVANTE : SURVIE ? =====
-                
-                // VIEILLISSEMENT ACCÉLÉRÉ POUR EMPÊCHER STABILITÉ
-                // Vieillissement normal
-                uint8_t increment_age = 1;
-                
-                // Accélération du vieillissement pour les cellules anciennes
-                if (cellule_actuelle->age > ACCELERATION_VIEILLISSEMENT) {
-                    increment_age = FACTEUR_ACCELERATION;
-                }
-                
-                cellule_suivante->age = cellule_actuelle->age + increment_age;
-                
-                // Mort de vieillesse
-                if (cellule_suivante->age >= AGE_MAXIMUM) {
-                    continue;  // Reste morte
-                }
-                
-                // Consommation de base
-                int consommation_base = CONSOMMATION_NUTRIMENTS;
-                
-                // Compétition naturelle pour les ressources (biologie réaliste)
-                if (nombre_voisins_vivants >= SEUIL_COMPETITION) {
-                    // En cas de compétition, chaque cellule accède à moins de ressources
-                    int ressources_disponibles = environnement->nutriments / (1 + nombre_voisins_vivants / 2);
-                    if (ressources_disponibles >= consommation_base) {
-                        environnement->nutriments -= consommation_base;
-                        cellule_suivante->sante = cellule_actuelle->sante; // Stable mais pas d'amélioration
-                        // Léger stress de compétition
-                        if (cellule_suivante->sante > STRESS_COMPETITION) {
-                            cellule_suivante->sante -= STRESS_COMPETITION;
-                        }
-                    } else {
-                        // Ressources insuffisantes en compétition
-                        cellule_suivante->sante = (cellule_actuelle->sante > 3) ? cellule_actuelle->sante - 3 : 0;
-                    }
-                } else {
-                    // Pas de compétition : croissance normale
-                    if (environnement->nutriments >= consommation_base) {
-                        environnement->nutriments -= consommation_base;
-                        cellule_suivante->sante = (cellule_actuelle->sante < 100) ? cellule_actuelle->sante + 1 : 100;
-                    } else {
-                        // Malnutrition légère
-                        cellule_suivante->sante = (cellule_actuelle->sante > 2) ? cellule_actuelle->sante - 2 : 0;
-                    }
-                }
-                
-                // Vieillissement naturel (perte progressive avec l'âge)
-                if (cellule_suivante->age > FERTILITE_DECLIN) {
-                    int perte_age = (cellule_suivante->age - FERTILITE_DECLIN) / 20;  // Vieillissement progressif
-                    cellule_suivante->sante = (cellule_suivante->sante > perte_age) ? 
-                                            cellule_suivante->sante - perte_age : 0;
-                }
-                
-                // === REALISTIC BIOLOGICAL SURVIVAL FACTORS ===
-                
-                // Disease mortality check (epidemiological realism)
-                if (environnement->pathogenes_present > 0) {
-                    generateur = generateur * 1103515245u + 12345u;
-                    float resistance_disease = (float)cellule_actuelle->resistance_maladie / 255.0f;
-                    float risk_disease = (float)environnement->pathogenes_present / 255.0f;
-                    float survival_probability = resistance_disease / (risk_disease + 0.1f);
-                    
-                    if ((float)(generateur % 1000) / 1000.0f > survival_probability) {
-                        continue;  // Death by disease
-                    }
-                }
-                
-                // Predation mortality check (predator-prey dynamics)
-                if (environnement->pression_predation > 0) {
-                    generateur = generateur * 1103515245u + 12345u;
-                    float camouflage_effectiveness = (float)cellule_actuelle->camouflage_predation / 255.0f;
-                    float predation_risk = (float)environnement->pression_predation / 255.0f;
-                    float escape_probability = camouflage_effectiveness;
-                    
-                    if ((float)(generateur % 1000) / 1000.0f > escape_probability && predation_risk > 0.2f) {
-                        continue;  // Death by predation
-                    }
-                }
-                
-                // Environmental toxicity effects
-                if (environnement->toxicite_locale > 100) {
-                    cellule_suivante->sante = (cellule_suivante->sante > 2) ? cellule_suivante->sante - 2 : 0;
-                }
-                
-                // Basic malnutrition check (more permissive)
-                if (cellule_suivante->sante < 1) {
-                    continue;  // Death by starvation
-                }
-                
-                // INSTABILITÉ GÉNÉTIQUE PROGRESSIVE 
-                // L'instabilité augmente avec l'âge et les générations pour empêcher les structures stables
-                uint32_t instabilite_totale = 0;
-                if (cellule_suivante->age > SEUIL_INSTABILITE_AGE) {
-                    instabilite_totale += (cellule_suivante->age - SEUIL_INSTABILITE_AGE) / 10;
+    int position = debut;
+    for (; position + 16 <= fin; position += 16) {
+        octets_x16 densite = *(const octets_x16_u*)&densites[position];
+        
+        // Nutriments : régénération plafonnée, ou lente décroissance en disette
+        octets_x16 nutriments = *(const octets_x16_u*)&env->nutriments[position];
+        octets_x16 sous = (octets_x16)(nutriments < maximum);
+        octets_x16 sur = (octets_x16)(nutriments > maximum);
+        octets_x16 regeneres = nutriments + REGENERATION_NUTRIMENTS;
+        octets_x16 plafond = (octets_x16)(regeneres > maximum);
+        regeneres = (regeneres & ~plafond) | (maximum & plafond);
+        nutriments = (sous & regeneres) | (sur & (octets_x16)(nutriments - 1)) | (~(sous | sur) & nutriments);
+        *(octets_x16_u*)&env->nutriments[position] = nutriments;
+        
+        // Pression de prédation : 8 produits 16 x 16 bits (partie haute) par moitié
+        mots_x8 gradient_bas = *(const mots_x8_u*)&gradient[position];
+        mots_x8 gradient_haut = *(const mots_x8_u*)&gradient[position + 8];
+        mots_x8 pression_bas = __builtin_ia32_pmulhuw128(gradient_bas, facteur);
+        mots_x8 pression_haut = __builtin_ia32_pmulhuw128(gradient_haut, facteur);
+        *(signes_x16_u*)&env->pression_predation[position] = __builtin_ia32_packuswb128(pression_bas, pression_haut);
+        
+        // Pathogènes, compétition et toxicité ne dépendent que de la densité 3x3
+        octets_x16 bloc_dense = (octets_x16)(densite > 4);
+        *(octets_x16_u*)&env->pathogenes_present[position] = (bloc_dense & dense) | (~bloc_dense & clairseme);
+        
+        octets_x16 surpeuple = (octets_x16)(densite > MIGRATION_PRESSURE_THRESHOLD);
+        *(octets_x16_u*)&env->competition_territoriale[position] =
+            surpeuple & (octets_x16)(densite * TERRITORIAL_COMPETITION);
+        
+        octets_x16 pollue = (octets_x16)(densite > 6);
+        octets_x16 toxicite = *(const octets_x16_u*)&env->toxicite_locale[position];
+        octets_x16 decroissance = (toxicite - 5) & ~(octets_x16)(toxicite == 0);
+        *(octets_x16_u*)&env->toxicite_locale[position] =
+            (pollue & (octets_x16)((densite - 6) * 20)) | (~pollue & decroissance);
+    }
+    return position;
+}
+
+// Resolve phase of the nutrient accounting on the sites [debut, debut + 16 x k), 16 per instruction
+NOYAU_SSE2 static int resoudre_demande_nutriments_sse2(AutomateCellulaire *automate, int debut, int fin) {
+    uint8_t *nutriments = automate->environnement.nutriments;
+    const uint8_t *demande = automate->demande_nutriments;
+    
+    int position = debut;
+    for (; position + 16 <= fin; position += 16) {
+        *(octets_x16_u*)&nutriments[position] =
+            *(const octets_x16_u*)&nutriments[position] - *(const octets_x16_u*)&demande[position];
+    }
+    return position;
+}
+#endif
+
+// =============================
+// PLAN D'OCCUPATION ET COMPTAGE DES VOISINS
+// =============================
+
+// Quatre octets lus d'un coup, sans contrainte d'alignement
+typedef uint32_t quatre_octets_u __attribute__((aligned(1), may_alias));
+
+// Remet "nombre" octets à zéro quatre par quatre (le noyau n'a pas de memset)
+static inline void effacer_octets(uint8_t *octets, int nombre) {
+    int i = 0;
+    for (; i + 4 <= nombre; i += 4) *(quatre_octets_u*)&octets[i] = 0;
+    for (; i < nombre; i++) octets[i] = 0;
+}
+
+// Copie "nombre" octets quatre par quatre (le noyau n'a pas de memcpy)
+static inline void copier_octets(uint8_t *destination, const uint8_t *source, int nombre) {
+    int i = 0;
+    for (; i + 4 <= nombre; i += 4) *(quatre_octets_u*)&destination[i] = *(const quatre_octets_u*)&source[i];
+    for (; i < nombre; i++) destination[i] = source[i];
+}
+
+/**
+ * Refreshes the two halo rows of a bitplane: copies of the opposite rows on a
+ * torus, empty rows with BORD_FIXE. Done once per generation, so the 3x3 sums
+ * never wrap the row index
+ */
+static void rafraichir_halo_plan(const AutomateCellulaire *automate, uint32_t *plan) {
+    int hauteur = automate->hauteur_grille;
+    uint32_t mots_par_ligne = MOTS_PAR_LIGNE(automate->largeur_grille);
+    uint32_t *halo_haut = plan - mots_par_ligne;
+    uint32_t *halo_bas = &plan[hauteur * mots_par_ligne];
+    int torique = (automate->bord == BORD_TORIQUE);
+    
+    for (uint32_t mot = 0; mot < mots_par_ligne; mot++) {
+        halo_haut[mot] = torique ? plan[(hauteur - 1) * mots_par_ligne + mot] : 0;
+        halo_bas[mot] = torique ? plan[mot] : 0;
+    }
+}
+
+/**
+ * Active tiles of the bands [premiere_rangee, fin_rangees) from the populated ones:
+ * a tile is active when it or one of its 8 neighbor tiles is populated (across the
+ * edges on a torus). A 3x3 block never reaches beyond the neighbor tiles, so every
+ * cell of an inactive tile has a zero count
+ */
+static void etendre_tuiles_actives(AutomateCellulaire *automate, uint32_t premiere_rangee, uint32_t fin_rangees) {
+    int tuiles_par_ligne = (int)MOTS_PAR_LIGNE(automate->largeur_grille);
+    int tuiles_par_colonne = (int)TUILES_PAR_COLONNE(automate->hauteur_grille);
+    const uint8_t *peuplees = automate->tuiles_peuplees;
+    int torique = (automate->bord == BORD_TORIQUE);
+    
+    for (int rangee = (int)premiere_rangee; rangee < (int)fin_rangees; rangee++) {
+        for (int mot = 0; mot < tuiles_par_ligne; mot++) {
+            uint8_t active = 0;
+            for (int decalage_rangee = -1; decalage_rangee <= 1; decalage_rangee++) {
+                int voisine_rangee = rangee + decalage_rangee;
+                if (voisine_rangee < 0 || voisine_rangee >= tuiles_par_colonne) {
+                    if (!torique) continue;
+                    voisine_rangee = (voisine_rangee < 0) ? tuiles_par_colonne - 1 : 0;
                 }
-                instabilite_totale += (automate->generation_actuelle * INSTABILITE_GENERATION) / 10000;  // Très réduit
-                
-                // Chance de mutation spontanée progressive (très réduite)
-                generateur = generateur * 1103515245u + 12345u;
-                if ((generateur % 1000) < instabilite_totale) {  // Changé de % 100 à % 1000 pour réduire drastiquement
-                    // Instabilité : survie/mort aléatoire qui brise les patterns stables
-                    if ((generateur >> 8) % 100 < 10) {  // Réduit de 30% à 10% de chance de mort spontanée
-                        continue;  // Mort par instabilité génétique
+                for (int decalage_mot = -1; decalage_mot <= 1; decalage_mot++) {
+                    int voisin_mot = mot + decalage_mot;
+                    if (voisin_mot < 0 || voisin_mot >= tuiles_par_ligne) {
+                        if (!torique) continue;
+                        voisin_mot = (voisin_mot < 0) ? tuiles_par_ligne - 1 : 0;
                     }
+                    active |= peuplees[voisine_rangee * tuiles_par_ligne + voisin_mot];
                 }
-                
-                // MORTALITÉ FORCÉE PAR HAUTE DENSITÉ LOCALE
-                // Empêche les blocs stables en forçant la mort en zones denses
-                if (nombre_voisins_vivants >= SEUIL_DENSITE_FATALE) {
-                    generateur = generateur * 1103515245u + 12345u;
-                    if ((generateur % 100) < CHANCE_MORT_DENSITE) {
-                        continue;  // Mort par surpopulation locale
+            }
+            automate->tuiles_actives[rangee * tuiles_par_ligne + mot] = active;
+        }
+    }
+}
+
+// Tuiles peuplées des rangées [premiere_rangee, fin_rangees) depuis le plan : une tuile
+// est peuplée si l'un de ses mots a un bit à 1
+static void marquer_tuiles_peuplees(AutomateCellulaire *automate, uint32_t premiere_rangee, uint32_t fin_rangees) {
+    int hauteur = automate->hauteur_grille;
+    int tuiles_par_ligne = (int)MOTS_PAR_LIGNE(automate->largeur_grille);
+    const uint32_t *plan = automate->plan_occupation;
+    uint8_t *peuplees = automate->tuiles_peuplees;
+    
+    for (int rangee = (int)premiere_rangee; rangee < (int)fin_rangees; rangee++) {
+        int premiere_ligne = rangee * COTE_TUILE;
+        int fin_lignes = (premiere_ligne + COTE_TUILE < hauteur) ? premiere_ligne + COTE_TUILE : hauteur;
+        for (int mot = 0; mot < tuiles_par_ligne; mot++) {
+            uint32_t bits = 0;
+            for (int ligne = premiere_ligne; ligne < fin_lignes; ligne++) bits |= plan[ligne * tuiles_par_ligne + mot];
+            peuplees[rangee * tuiles_par_ligne + mot] = (bits != 0);
+        }
+    }
+}
+
+/**
+ * Regroupe l'état "vivante" des lignes [premiere_ligne, fin_lignes) en mots de 32
+ * cellules (bit x = colonne x), marque les parents potentiels (vivants et fertiles)
+ * dans la grille à halo, colonnes de halo comprises, et remplit leur cache de parent
+ * (les cycles de la génération doivent être prêts). Chaque ligne n'écrit que ses sites
+ */
+static void construire_lignes_plan(AutomateCellulaire *automate, int premiere_ligne, int fin_lignes) {
+    int largeur = automate->largeur_grille;
+    int largeur_halo = largeur + 2;
+    uint32_t mots_par_ligne = MOTS_PAR_LIGNE(largeur);
+    const uint8_t *vivante = automate->etat_actuel.vivante;
+    const uint8_t *age = automate->etat_actuel.age;
+    uint8_t *parents = automate->parents_potentiels;
+    int torique = (automate->bord == BORD_TORIQUE);
+    
+    for (int ligne = premiere_ligne; ligne < fin_lignes; ligne++) {
+        const uint8_t *cellules = &vivante[ligne * largeur];
+        const uint8_t *ages = &age[ligne * largeur];
+        uint8_t *parents_ligne = &parents[(ligne + 1) * largeur_halo + 1];
+        uint32_t *mots = &automate->plan_occupation[ligne * mots_par_ligne];
+        for (uint32_t mot = 0; mot < mots_par_ligne; mot++) {
+            int debut = (int)(mot * BITS_PAR_MOT);
+            int fin = (debut + BITS_PAR_MOT < largeur) ? debut + BITS_PAR_MOT : largeur;
+            
+            // Quatre octets 0/1 par multiplication : l'octet k arrive au bit 24 + k
+            uint32_t bits = 0;
+            int colonne = debut;
+            for (; colonne + 4 <= fin; colonne += 4) {
+                uint32_t quatre = *(const quatre_octets_u*)&cellules[colonne] & 0x01010101u;
+                bits |= ((quatre * 0x01020408u) >> 24) << (colonne - debut);
+            }
+            for (; colonne < fin; colonne++) {
+                bits |= (cellules[colonne] & 1u) << (colonne - debut);
+            }
+            mots[mot] = bits;  // Les bits au-delà de la largeur restent à 0
+            
+            // Parents : seuls les mots peuplés sont parcourus cellule par cellule
+            effacer_octets(&parents_ligne[debut], fin - debut);
+            if (!bits) continue;
+            for (colonne = debut; colonne < fin; colonne++) {
+                if (!cellules[colonne]) continue;
+                uint32_t fertilite = fertilite_par_age[ages[colonne]];
+                if (fertilite < SEUIL_PARENT_FERTILE) continue;
+                int position = ligne * largeur + colonne;
+                parents_ligne[colonne] = 1;
+                preparer_cache_parent(automate, (uint32_t)position, fertilite, &automate->cache_parents[position]);
+            }
+        }
+        
+        // Colonnes de halo
+        parents_ligne[-1] = torique ? parents_ligne[largeur - 1] : 0;
+        parents_ligne[largeur] = torique ? parents_ligne[0] : 0;
+    }
+}
+
+// Lignes de halo du plan et de la grille des parents (coins compris), une fois toutes les lignes construites
+static void rafraichir_halos_occupation(AutomateCellulaire *automate) {
+    int hauteur = automate->hauteur_grille, largeur_halo = automate->largeur_grille + 2;
+    uint8_t *parents = automate->parents_potentiels;
+    int torique = (automate->bord == BORD_TORIQUE);
+    
+    uint8_t *halo_haut = parents, *halo_bas = &parents[(hauteur + 1) * largeur_halo];
+    for (int colonne = 0; colonne < largeur_halo; colonne++) {
+        halo_haut[colonne] = torique ? parents[hauteur * largeur_halo + colonne] : 0;
+        halo_bas[colonne] = torique ? parents[largeur_halo + colonne] : 0;
+    }
+    rafraichir_halo_plan(automate, automate->plan_occupation);
+}
+
+// Plan d'occupation, parents et tuiles actives de toute la grille
+static void construire_plan_occupation(AutomateCellulaire *automate) {
+    uint32_t tuiles_par_colonne = TUILES_PAR_COLONNE(automate->hauteur_grille);
+    construire_lignes_plan(automate, 0, automate->hauteur_grille);
+    rafraichir_halos_occupation(automate);
+    marquer_tuiles_peuplees(automate, 0, tuiles_par_colonne);
+    etendre_tuiles_actives(automate, 0, tuiles_par_colonne);
+}
+
+/**
+ * Horizontal 3-cell sums of one row for one word, as a 2-bit bit-sliced number
+ * (bit x of somme_0 / somme_1 = low / high bit of left + self + right at column x)
+ * On a torus the row wraps around (column 0 sees the last column and vice
+ * versa); with BORD_FIXE nothing comes in from beyond the edges
+ */
+static inline void sommer_ligne_horizontale(const uint32_t *mots, uint32_t mot, uint32_t mots_par_ligne,
+                                     int largeur, int torique, uint32_t *somme_0, uint32_t *somme_1) {
+    uint32_t centre = mots[mot];
+    uint32_t bit_dernier = (uint32_t)(largeur - 1) % BITS_PAR_MOT;
+    
+    // Voisin de gauche : bit x = cellule x-1
+    uint32_t retenue_gauche = (mot > 0) ? (mots[mot - 1] >> (BITS_PAR_MOT - 1))
+                                        : (torique ? (mots[mots_par_ligne - 1] >> bit_dernier) & 1u : 0);
+    uint32_t gauche = (centre << 1) | retenue_gauche;
+    
+    // Voisin de droite : bit x = cellule x+1
+    uint32_t droite = centre >> 1;
+    if (mot + 1 < mots_par_ligne) {
+        droite |= mots[mot + 1] << (BITS_PAR_MOT - 1);
+    } else if (torique) {
+        droite |= (mots[0] & 1u) << bit_dernier;
+    }
+    
+    *somme_0 = gauche ^ centre ^ droite;
+    *somme_1 = (gauche & centre) | (gauche & droite) | (centre & droite);
+}
+
+/**
+ * Vertical part of the separable 3x3 box sum: adds the 2-bit horizontal sums
+ * of the rows above (a), at (b) and below (c) into a 4-bit number (0..9)
+ */
+static inline void additionner_sommes_verticales(uint32_t a0, uint32_t a1, uint32_t b0, uint32_t b1,
+                                                 uint32_t c0, uint32_t c1, uint32_t somme[4]) {
+    // a + b (0..6) sur 3 bits
+    uint32_t s0 = a0 ^ b0;
+    uint32_t r0 = a0 & b0;
+    uint32_t s1 = a1 ^ b1 ^ r0;
+    uint32_t s2 = (a1 & b1) | (a1 & r0) | (b1 & r0);
+    
+    // + c (0..9) sur 4 bits
+    uint32_t r1 = s0 & c0;
+    uint32_t r2 = (s1 & c1) | (s1 & r1) | (c1 & r1);
+    somme[0] = s0 ^ c0;
+    somme[1] = s1 ^ c1 ^ r1;
+    somme[2] = s2 ^ r2;
+    somme[3] = s2 & r2;
+}
+
+// Étale 4 bits en 4 octets (bit i → octet i) pour dépaqueter les sommes 4 cellules à la fois
+static const uint32_t ETALEMENT_QUARTET[16] = {
+    0x00000000u, 0x00000001u, 0x00000100u, 0x00000101u,
+    0x00010000u, 0x00010001u, 0x00010100u, 0x00010101u,
+    0x01000000u, 0x01000001u, 0x01000100u, 0x01000101u,
+    0x01010000u, 0x01010001u, 0x01010100u, 0x01010101u
+};
+
+/**
+ * Counts the living cells of every 3x3 block (self included, 0..9) with
+ * bit-parallel adders: 32 cells per word, no per-neighbor load nor modulo
+ * Separable: each row's horizontal sum is computed once per word column and
+ * slides through an above / center / below window, as in the bitboard engine;
+ * the halo rows of the plane stand for the rows beyond the edges
+ * Result in densite_voisinage, shared by the environment and the cell update;
+ * the 8-neighbor count is densite - vivante (full words are unpacked 16 bytes
+ * at a time by the SSE2 kernel when it is selected)
+ * Inactive tiles (see etendre_tuiles_actives) only get zeros; the window is
+ * primed again at the first requested row of each active tile
+ * Rows [premiere_ligne, fin_lignes) of the band of tiles "rangee": the dense
+ * generation counts a block of rows just before using it, while they are still in cache
+ */
+static void compter_voisins_lignes(AutomateCellulaire *automate, uint32_t rangee, int premiere_ligne, int fin_lignes) {
+    int largeur = automate->largeur_grille;
+    uint32_t mots_par_ligne = MOTS_PAR_LIGNE(largeur);
+    const uint32_t *plan = automate->plan_occupation;
+    int torique = (automate->bord == BORD_TORIQUE);
+    
+    for (uint32_t mot = 0; mot < mots_par_ligne; mot++) {
+        int debut = (int)(mot * BITS_PAR_MOT);
+        int fin = (debut + BITS_PAR_MOT < largeur) ? debut + BITS_PAR_MOT : largeur;
+        
+        if (!automate->tuiles_actives[rangee * mots_par_ligne + mot]) {
+            // Aucune cellule vivante dans la tuile ni autour : comptes nuls
+            for (int ligne = premiere_ligne; ligne < fin_lignes; ligne++) {
+                effacer_octets(&automate->densite_voisinage[ligne * largeur + debut], fin - debut);
+            }
+            continue;
+        }
+        
+        const uint32_t *plan_tuile = &plan[premiere_ligne * mots_par_ligne];
+        uint32_t a0, a1, b0, b1, c0, c1;
+        sommer_ligne_horizontale(plan_tuile - mots_par_ligne, mot, mots_par_ligne, largeur, torique, &a0, &a1);
+        sommer_ligne_horizontale(plan_tuile, mot, mots_par_ligne, largeur, torique, &b0, &b1);
+        
+        for (int ligne = premiere_ligne; ligne < fin_lignes; ligne++) {
+            sommer_ligne_horizontale(&plan[(ligne + 1) * mots_par_ligne], mot, mots_par_ligne, largeur, torique, &c0, &c1);
+            
+            uint32_t somme[4];
+            additionner_sommes_verticales(a0, a1, b0, b1, c0, c1, somme);
+            uint8_t *densites = &automate->densite_voisinage[ligne * largeur];
+            
+            if ((somme[0] | somme[1] | somme[2] | somme[3]) == 0) {
+                // Bloc de 32 cellules sans aucun voisin vivant (cas courant en grille clairsemée)
+                effacer_octets(&densites[debut], fin - debut);
+#if SSE2_COMPILABLE
+            } else if (noyau_sse2_actif && fin - debut == BITS_PAR_MOT) {
+                etaler_sommes_sse2(somme, &densites[debut]);
+#endif
+            } else {
+                for (int colonne = debut; colonne < fin; colonne += 4) {
+                    int bit = colonne - debut;
+                    uint32_t quatre = ETALEMENT_QUARTET[(somme[0] >> bit) & 15u] |
+                                      (ETALEMENT_QUARTET[(somme[1] >> bit) & 15u] << 1) |
+                                      (ETALEMENT_QUARTET[(somme[2] >> bit) & 15u] << 2) |
+                                      (ETALEMENT_QUARTET[(somme[3] >> bit) & 15u] << 3);
+                    int restantes = (fin - colonne < 4) ? fin - colonne : 4;
+                    for (int octet = 0; octet < restantes; octet++) {
+                        densites[colonne + octet] = (uint8_t)(quatre >> (8 * octet));
                     }
                 }
-                
-                // Application des règles de survie modifiées par génotype
-                uint16_t masque_survie_adapte = automate->masque_conditions_survie;
-                // Modification légère selon génotype (rend certaines cellules plus résistantes)
-                if (cellule_actuelle->genotype_survie > 128) {
-                    masque_survie_adapte |= (1u << (nombre_voisins_vivants + 1));  // Tolère un voisin de plus
-                } else if (cellule_actuelle->genotype_survie < 64) {
-                    masque_survie_adapte &= ~(1u << (nombre_voisins_vivants - 1));  // Tolère un voisin de moins
+            }
+            
+            // La fenêtre descend d'une ligne
+            a0 = b0; a1 = b1;
+            b0 = c0; b1 = c1;
+        }
+    }
+}
+
+// Comptage sur toute la grille, bande par bande
+static void compter_voisins(AutomateCellulaire *automate) {
+    int hauteur = automate->hauteur_grille;
+    uint32_t tuiles_par_colonne = TUILES_PAR_COLONNE(hauteur);
+    for (uint32_t rangee = 0; rangee < tuiles_par_colonne; rangee++) {
+        int premiere_ligne = (int)(rangee * COTE_TUILE);
+        int fin_lignes = (premiere_ligne + COTE_TUILE < hauteur) ? premiere_ligne + COTE_TUILE : hauteur;
+        compter_voisins_lignes(automate, rangee, premiere_ligne, fin_lignes);
+    }
+}
+
+// =============================
+// MOTEUR BITBOARD (RÈGLES B/S PURES)
+// =============================
+
+// Nombre de bits à 1 dans un mot (SWAR, sans dépendance à libgcc)
+static uint32_t compter_bits_mot(uint32_t mot) {
+    mot = mot - ((mot >> 1) & 0x55555555u);
+    mot = (mot & 0x33333333u) + ((mot >> 2) & 0x33333333u);
+    mot = (mot + (mot >> 4)) & 0x0F0F0F0Fu;
+    return (mot * 0x01010101u) >> 24;
+}
+
+// Règles B/S prêtes pour le calcul par mots
+typedef struct {
+    uint32_t masque_naissance;
+    uint32_t masque_survie;       // Décalé d'un rang : somme 3x3 = voisins + 1
+    uint32_t sommes_utiles[10];   // Sommes présentes dans l'un des masques (2 ou 3 pour les règles usuelles)
+    int nombre_sommes;
+} ReglesBitboard;
+
+static void preparer_regles_bitboard(const AutomateCellulaire *automate, ReglesBitboard *regles) {
+    regles->masque_naissance = automate->masque_conditions_naissance;
+    regles->masque_survie = (uint32_t)automate->masque_conditions_survie << 1;
+    regles->nombre_sommes = 0;
+    for (uint32_t somme = 0; somme <= 9; somme++) {
+        if ((regles->masque_naissance | regles->masque_survie) & (1u << somme)) {
+            regles->sommes_utiles[regles->nombre_sommes++] = somme;
+        }
+    }
+}
+
+/**
+ * Plain B/S rules on "nombre_lignes" rows, 32 cells per word: bit-sliced 3x3
+ * sums (self included) are matched against the birth mask for dead cells and
+ * against the survival mask shifted by one for living cells
+ * Row i of destination comes from rows i-1, i, i+1 of source (source[-1] and
+ * source[nombre_lignes] are read); the population of the rows written is added
+ * to *population unless it is NULL
+ */
+static void calculer_lignes_bitboard(const AutomateCellulaire *automate, const ReglesBitboard *regles,
+                                     const uint32_t *source, uint32_t *destination, int nombre_lignes,
+                                     uint32_t *population) {
+    int largeur = automate->largeur_grille;
+    uint32_t mots_par_ligne = MOTS_PAR_LIGNE(largeur);
+    int torique = (automate->bord == BORD_TORIQUE);
+    
+    // Bits valides du dernier mot de chaque ligne
+    uint32_t bits_fin = (uint32_t)largeur % BITS_PAR_MOT;
+    uint32_t masque_dernier_mot = bits_fin ? (1u << bits_fin) - 1u : 0xFFFFFFFFu;
+    uint32_t vivantes = 0;
+    
+    // Parcours par colonnes de mots : la somme horizontale de chaque ligne est
+    // calculée une seule fois et glisse dans une fenêtre haut / centre / bas
+    for (uint32_t mot = 0; mot < mots_par_ligne; mot++) {
+        uint32_t masque_mot = (mot + 1 == mots_par_ligne) ? masque_dernier_mot : 0xFFFFFFFFu;
+        uint32_t a0, a1, b0, b1, c0, c1;
+        sommer_ligne_horizontale(source - mots_par_ligne, mot, mots_par_ligne, largeur, torique, &a0, &a1);
+        sommer_ligne_horizontale(source, mot, mots_par_ligne, largeur, torique, &b0, &b1);
+        
+        for (int ligne = 0; ligne < nombre_lignes; ligne++) {
+            sommer_ligne_horizontale(&source[(ligne + 1) * mots_par_ligne], mot, mots_par_ligne, largeur, torique, &c0, &c1);
+            
+            // a + b + c (0..9) sur 4 bits, comme compter_voisins
+            uint32_t d[4];
+            additionner_sommes_verticales(a0, a1, b0, b1, c0, c1, d);
+            
+            // Cellules dont la somme appartient à chaque masque
+            uint32_t selon_naissance = 0, selon_survie = 0;
+            for (int indice = 0; indice < regles->nombre_sommes; indice++) {
+                uint32_t somme = regles->sommes_utiles[indice];
+                uint32_t egal = ((somme & 1u) ? d[0] : ~d[0]) & ((somme & 2u) ? d[1] : ~d[1]) &
+                                ((somme & 4u) ? d[2] : ~d[2]) & ((somme & 8u) ? d[3] : ~d[3]);
+                if (regles->masque_naissance & (1u << somme)) selon_naissance |= egal;
+                if (regles->masque_survie & (1u << somme)) selon_survie |= egal;
+            }
+            
+            uint32_t centre = source[ligne * mots_par_ligne + mot];
+            uint32_t suivant = ((~centre & selon_naissance) | (centre & selon_survie)) & masque_mot;  // Pas de naissance hors grille
+            
+            destination[ligne * mots_par_ligne + mot] = suivant;
+            if (population) vivantes += compter_bits_mot(suivant);
+            
+            // La fenêtre descend d'une ligne
+            a0 = b0; a1 = b1;
+            b0 = c0; b1 = c1;
+        }
+    }
+    if (population) *population += vivantes;
+}
+
+/**
+ * "profondeur" generations of plain B/S rules in one pass over the grid (temporal
+ * blocking, 2 <= profondeur <= PROFONDEUR_TEMPORELLE_MAX)
+ * Each band of LIGNES_BANDE_TEMPORELLE rows is copied with "profondeur" rows above
+ * and below (across the edges: the opposite rows on a torus, empty rows with
+ * BORD_FIXE) into a scratch band and advanced there. Every generation the rows
+ * that are still exact shrink by one at both ends, so that after "profondeur"
+ * generations exactly the band's own rows are; the last one writes them into
+ * plan_suivant. The halo rows are computed again by each band they border, in
+ * exchange the bitplane goes through memory once instead of "profondeur" times
+ */
+static void calculer_generations_bitboard_par_bandes(AutomateCellulaire *automate, uint32_t profondeur) {
+    int hauteur = automate->hauteur_grille;
+    uint32_t mots_par_ligne = MOTS_PAR_LIGNE(automate->largeur_grille);
+    const uint32_t *plan = automate->plan_occupation;
+    int torique = (automate->bord == BORD_TORIQUE);
+    int halo = (int)profondeur;
+    uint32_t *bandes[2] = {
+        automate->bandes_temporelles,
+        automate->bandes_temporelles + (LIGNES_BANDE_TEMPORELLE + 2 * PROFONDEUR_TEMPORELLE_MAX) * mots_par_ligne
+    };
+    ReglesBitboard regles;
+    preparer_regles_bitboard(automate, &regles);
+    uint32_t population = 0;
+    
+    for (int premiere_ligne = 0; premiere_ligne < hauteur; premiere_ligne += LIGNES_BANDE_TEMPORELLE) {
+        int lignes = (premiere_ligne + LIGNES_BANDE_TEMPORELLE < hauteur) ? LIGNES_BANDE_TEMPORELLE
+                                                                         : hauteur - premiere_ligne;
+        int lignes_bande = lignes + 2 * halo;
+        
+        // Ligne locale i = ligne premiere_ligne - halo + i de la grille ; hors de la
+        // grille avec BORD_FIXE, elle reste vide dans les deux bandes
+        for (int locale = 0; locale < lignes_bande; locale++) {
+            int ligne = premiere_ligne - halo + locale;
+            uint32_t *copie = &bandes[0][locale * mots_par_ligne];
+            if (torique) {
+                ligne = ((ligne % hauteur) + hauteur) % hauteur;
+            } else if (ligne < 0 || ligne >= hauteur) {
+                for (uint32_t mot = 0; mot < mots_par_ligne; mot++) {
+                    copie[mot] = 0;
+                    bandes[1][locale * mots_par_ligne + mot] = 0;
                 }
-                
-                if (masque_survie_adapte & (1u << nombre_voisins_vivants)) {
-                    // Survie !
-                    cellule_suivante->vivante = 1;
-                    cellule_suivante->genotype_survie = cellule_actuelle->genotype_survie;
-                    cellule_suivante->genotype_naissance = cellule_actuelle->genotype_naissance;
-                    
-                    // Conservation des propriétés de race et mouvement
-                    cellule_suivante->race = cellule_actuelle->race;
-                    cellule_suivante->polarisation = cellule_actuelle->polarisation;
-                    cellule_suivante->force_polarisation = cellule_actuelle->force_polarisation;
-                    cellule_suivante->compteur_mouvement = cellule_actuelle->compteur_mouvement + 1;
-                    
-                    // Conservation des traits évolutifs et biologiques
-                    cellule_suivante->fitness_reproductif = cellule_actuelle->fitness_reproductif;
-                    cellule_suivante->efficacite_energetique = cellule_actuelle->efficacite_energetique;
-                    cellule_suivante->espece_id = cellule_actuelle->espece_id;
-                    cellule_suivante->resistance_maladie = cellule_actuelle->resistance_maladie;
-                    cellule_suivante->camouflage_predation = cellule_actuelle->camouflage_predation;
-                    cellule_suivante->territorialite = cellule_actuelle->territorialite;
-                    cellule_suivante->adaptabilite_stress = cellule_actuelle->adaptabilite_stress;
-                    cellule_suivante->generation_naissance = cellule_actuelle->generation_naissance;
-                    
-                    automate->population_totale++;
+                continue;
+            }
+            for (uint32_t mot = 0; mot < mots_par_ligne; mot++) copie[mot] = plan[ligne * mots_par_ligne + mot];
+        }
+        
+        // Générations intermédiaires : lignes locales [etape, lignes_bande - etape),
+        // sans les lignes hors de la grille avec BORD_FIXE
+        int source = 0;
+        for (int etape = 1; etape < halo; etape++) {
+            int debut = etape, fin = lignes_bande - etape;
+            if (!torique) {
+                if (debut < halo - premiere_ligne) debut = halo - premiere_ligne;
+                if (fin > halo - premiere_ligne + hauteur) fin = halo - premiere_ligne + hauteur;
+            }
+            calculer_lignes_bitboard(automate, &regles, &bandes[source][debut * mots_par_ligne],
+                                     &bandes[1 - source][debut * mots_par_ligne], fin - debut, NULL);
+            source = 1 - source;
+        }
+        
+        // Dernière génération : les lignes de la bande, écrites dans le plan suivant
+        calculer_lignes_bitboard(automate, &regles, &bandes[source][halo * mots_par_ligne],
+                                 &automate->plan_suivant[premiere_ligne * mots_par_ligne], lignes, &population);
+    }
+    
+    automate->plan_occupation = automate->plan_suivant;
+    automate->plan_suivant = (uint32_t*)plan;
+    automate->population_totale = population;
+    automate->generation_actuelle += profondeur;
+}
+
+// Nutriments d'un site : régénération plafonnée, ou lente décroissance en disette
+static inline uint8_t regenerer_nutriments(uint8_t nutriments, int nutriments_max) {
+    if (nutriments < nutriments_max) {
+        int regeneres = nutriments + REGENERATION_NUTRIMENTS;
+        return (uint8_t)((regeneres > nutriments_max) ? nutriments_max : regeneres);
+    }
+    if (nutriments > nutriments_max) return nutriments - 1;  // Gradual decrease during scarcity
+    return nutriments;
+}
+
+/**
+ * Updates environmental factors with realistic biological cycles on the sites
+ * [debut, fin) of one row: predation, disease, food scarcity, territorial pressure
+ */
+static void mettre_a_jour_segment_environnement(AutomateCellulaire *automate, int debut, int fin,
+                                                int nutriments_max) {
+    EnvironnementCellules *env = &automate->environnement;
+    
+    // Global environmental factors are computed once (preparer_cycles_generation):
+    // the cell loop only reads tables
+    const CyclesGeneration *cycles = &automate->cycles;
+    
+    // Noyau SSE2 sur les blocs de 16 sites, la fin du segment en scalaire
+    int debut_scalaire = debut;
+#if SSE2_COMPILABLE
+    if (noyau_sse2_actif) debut_scalaire = mettre_a_jour_environnement_sse2(automate, debut, fin, nutriments_max);
+#endif
+    
+    for (int position = debut_scalaire; position < fin; position++) {
+        // Local population density (3x3 block) for realistic environmental pressure
+        int densite_locale = automate->densite_voisinage[position];
+        
+        // Update nutrient availability based on seasonal cycles
+        env->nutriments[position] = regenerer_nutriments(env->nutriments[position], nutriments_max);
+        
+        // Update predation pressure (realistic predator-prey dynamics)
+        env->pression_predation[position] = calculer_pression_predation(cycles->intensite_predation,
+                                                                        automate->gradient_predation[position]);
+        
+        // Update disease presence (epidemiological modeling)
+        env->pathogenes_present[position] = (densite_locale > 4) ? cycles->pathogenes_dense : cycles->pathogenes_clairseme;
+        
+        // Territorial competition increases with local density
+        env->competition_territoriale[position] = (densite_locale > MIGRATION_PRESSURE_THRESHOLD) ? 
+                                                  (densite_locale * TERRITORIAL_COMPETITION) : 0;
+        
+        // Environmental toxicity (pollution from overcrowding)
+        if (densite_locale > 6) {
+            env->toxicite_locale[position] = (densite_locale - 6) * 20;
+        } else {
+            env->toxicite_locale[position] = (env->toxicite_locale[position] > 0) ? env->toxicite_locale[position] - 5 : 0;
+        }
+    }
+}
+
+/**
+ * After the update of an empty tile: a tile whose sites share one nutrient level
+ * and have no toxicity left can be deferred (its level is written to *niveau)
+ */
+static int environnement_tuile_uniforme(const AutomateCellulaire *automate, uint32_t tuile, uint8_t *niveau) {
+    const EnvironnementCellules *env = &automate->environnement;
+    int premiere_ligne, fin_lignes, debut, fin;
+    bornes_tuile(automate, tuile, &premiere_ligne, &fin_lignes, &debut, &fin);
+    
+    uint8_t nutriments = env->nutriments[premiere_ligne * automate->largeur_grille + debut];
+    for (int ligne = premiere_ligne; ligne < fin_lignes; ligne++) {
+        int origine = ligne * automate->largeur_grille;
+        for (int position = origine + debut; position < origine + fin; position++) {
+            if (env->nutriments[position] != nutriments || env->toxicite_locale[position] != 0) return 0;
+        }
+    }
+    *niveau = nutriments;
+    return 1;
+}
+
+// Plafond de nutriments de la génération (cycle de disponibilité de la nourriture)
+static int calculer_nutriments_max(const AutomateCellulaire *automate) {
+    uint32_t disponibilite_nourriture = calculer_disponibilite_nourriture(automate->generation_actuelle);
+    return (int)((NUTRIMENTS_INITIAUX * disponibilite_nourriture) >> 8);
+}
+
+// Tuile dont seul le niveau de nutriments partagé avance (différée, sans voisin vivant)
+#define TUILE_RESTE_DIFFEREE(automate, tuile) \
+    ((automate)->tuiles_differees[tuile] && !(automate)->tuiles_actives[tuile])
+
+/**
+ * Environment update, tile by tile. Without any living cell around, every site
+ * of a tile follows the same rules with a zero count: once the nutrients of its
+ * sites are equal and the toxicity has faded, the tile is deferred and only its
+ * shared nutrient level advances (lire_site_differe gives the rest)
+ * A deferred tile that becomes active gets its arrays back before the update;
+ * runs of updated tiles are processed row by row as one segment
+ * Split in three steps so that a generation can interleave the rows with the
+ * cell update (see calculer_lignes_denses): preparer advances the deferred tiles
+ * and materializes the reactivated ones, the rows are updated by blocks, conclure
+ * checks which inactive tiles can be deferred. The rows read and write nothing but
+ * their own sites, and the first and last steps nothing but the tiles of their band
+ */
+static void preparer_bande_environnement(AutomateCellulaire *automate, uint32_t rangee, int nutriments_max) {
+    uint32_t tuiles_par_ligne = MOTS_PAR_LIGNE(automate->largeur_grille);
+    uint32_t premiere_tuile = rangee * tuiles_par_ligne;
+    uint8_t *niveaux = &automate->nutriments_tuiles[premiere_tuile];
+    
+    for (uint32_t tuile = 0; tuile < tuiles_par_ligne; tuile++) {
+        if (TUILE_RESTE_DIFFEREE(automate, premiere_tuile + tuile)) {
+            // Tuile vide différée : seul son niveau de nutriments avance
+            niveaux[tuile] = regenerer_nutriments(niveaux[tuile], nutriments_max);
+        } else if (automate->tuiles_differees[premiere_tuile + tuile]) {
+            materialiser_tuile(automate, premiere_tuile + tuile);
+        }
+    }
+}
+
+// Lignes [premiere_ligne, fin_lignes) de la bande : les suites de tuiles non différées,
+// chacune d'un seul segment par ligne
+static void mettre_a_jour_lignes_environnement(AutomateCellulaire *automate, uint32_t rangee,
+                                               int premiere_ligne, int fin_lignes, int nutriments_max) {
+    int largeur = automate->largeur_grille;
+    uint32_t tuiles_par_ligne = MOTS_PAR_LIGNE(largeur);
+    uint32_t premiere_tuile = rangee * tuiles_par_ligne;
+    
+    for (uint32_t tuile = 0; tuile < tuiles_par_ligne; ) {
+        if (TUILE_RESTE_DIFFEREE(automate, premiere_tuile + tuile)) {
+            tuile++;
+            continue;
+        }
+        uint32_t fin_suite = tuile + 1;
+        while (fin_suite < tuiles_par_ligne && !TUILE_RESTE_DIFFEREE(automate, premiere_tuile + fin_suite)) fin_suite++;
+        int debut = (int)(tuile * COTE_TUILE);
+        int fin = (fin_suite * COTE_TUILE < (uint32_t)largeur) ? (int)(fin_suite * COTE_TUILE) : largeur;
+        for (int ligne = premiere_ligne; ligne < fin_lignes; ligne++) {
+            mettre_a_jour_segment_environnement(automate, ligne * largeur + debut, ligne * largeur + fin,
+                                                nutriments_max);
+        }
+        tuile = fin_suite;
+    }
+}
+
+// Fin de bande : les tuiles inactives mises à jour deviennent différées si elles sont uniformes
+// Retourne le nombre de tuiles de la bande dont l'environnement a été mis à jour
+static uint32_t conclure_bande_environnement(AutomateCellulaire *automate, uint32_t rangee) {
+    uint32_t tuiles_par_ligne = MOTS_PAR_LIGNE(automate->largeur_grille);
+    uint32_t premiere_tuile = rangee * tuiles_par_ligne;
+    uint32_t tuiles_mises_a_jour = 0;
+    
+    for (uint32_t tuile = premiere_tuile; tuile < premiere_tuile + tuiles_par_ligne; tuile++) {
+        if (TUILE_RESTE_DIFFEREE(automate, tuile)) continue;
+        if (!automate->tuiles_actives[tuile]) {
+            automate->tuiles_differees[tuile] = (uint8_t)environnement_tuile_uniforme(automate, tuile,
+                                                                                      &automate->nutriments_tuiles[tuile]);
+        }
+        tuiles_mises_a_jour++;
+    }
+    return tuiles_mises_a_jour;
+}
+
+static void preparer_environnement(AutomateCellulaire *automate, int nutriments_max) {
+    uint32_t tuiles_par_colonne = TUILES_PAR_COLONNE(automate->hauteur_grille);
+    for (uint32_t rangee = 0; rangee < tuiles_par_colonne; rangee++) {
+        preparer_bande_environnement(automate, rangee, nutriments_max);
+    }
+}
+
+static void conclure_environnement(AutomateCellulaire *automate) {
+    uint32_t tuiles_par_colonne = TUILES_PAR_COLONNE(automate->hauteur_grille);
+    automate->tuiles_environnement = 0;
+    for (uint32_t rangee = 0; rangee < tuiles_par_colonne; rangee++) {
+        automate->tuiles_environnement += conclure_bande_environnement(automate, rangee);
+    }
+}
+
+// Mise à jour de l'environnement sur toute la grille, bande par bande
+static void mettre_a_jour_environnement(AutomateCellulaire *automate) {
+    int hauteur = automate->hauteur_grille;
+    uint32_t tuiles_par_colonne = TUILES_PAR_COLONNE(hauteur);
+    int nutriments_max = calculer_nutriments_max(automate);
+    
+    preparer_environnement(automate, nutriments_max);
+    for (uint32_t rangee = 0; rangee < tuiles_par_colonne; rangee++) {
+        int premiere_ligne = (int)(rangee * COTE_TUILE);
+        int fin_lignes = (premiere_ligne + COTE_TUILE < hauteur) ? premiere_ligne + COTE_TUILE : hauteur;
+        mettre_a_jour_lignes_environnement(automate, rangee, premiere_ligne, fin_lignes, nutriments_max);
+    }
+    conclure_environnement(automate);
+}
+
+/**
+ * Retient les voisins vivants assez âgés pour se reproduire, dans l'ordre de balayage
+ * Lecture par décalages fixes dans la grille à halo : ni modulo ni test de bord,
+ * seule la position d'un parent trouvé est ramenée dans la grille
+ */
+static void collecter_parents_fertiles(const AutomateCellulaire *automate, int ligne, int colonne,
+                                       VoisinageCellule *voisinage) {
+    int largeur = automate->largeur_grille, hauteur = automate->hauteur_grille;
+    int largeur_halo = largeur + 2;
+    const uint8_t *centre = &automate->parents_potentiels[(ligne + 1) * largeur_halo + colonne + 1];
+    
+    voisinage->nombre_parents_fertiles = 0;
+    
+    for (int decalage_ligne = -1; decalage_ligne <= 1; decalage_ligne++) {
+        const uint8_t *rangee = centre + decalage_ligne * largeur_halo;
+        for (int decalage_colonne = -1; decalage_colonne <= 1; decalage_colonne++) {
+            if ((decalage_ligne == 0 && decalage_colonne == 0) || !rangee[decalage_colonne]) continue;
+            
+            // Parent dans le halo : seulement sur un tore, c'est la cellule du bord opposé
+            int ligne_voisin = ligne + decalage_ligne;
+            int colonne_voisin = colonne + decalage_colonne;
+            if (ligne_voisin < 0) ligne_voisin = hauteur - 1;
+            else if (ligne_voisin >= hauteur) ligne_voisin = 0;
+            if (colonne_voisin < 0) colonne_voisin = largeur - 1;
+            else if (colonne_voisin >= largeur) colonne_voisin = 0;
+            
+            voisinage->positions_parents[voisinage->nombre_parents_fertiles++] =
+                (uint32_t)(ligne_voisin * largeur + colonne_voisin);
+        }
+    }
+}
+
+/**
+ * Reads table_transition for a cell: 0 when the rule can neither keep it alive
+ * nor give it birth, whatever the biology
+ */
+static inline int transition_possible(const AutomateCellulaire *automate, int vivante, int nombre_voisins_vivants) {
+    return automate->table_transition[vivante][nombre_voisins_vivants];
+}
+
+/**
+ * Survival branch for a living cell the rule keeps (see table_transition):
+ * aging, nutrients, disease, predation and genetic instability
+ * Only the hot state is written: a survivor keeps its cold traits in place
+ * (the caller counts the population from etat_suivant.vivante)
+ * The environment is only read: the nutrients used are recorded in
+ * demande_nutriments and subtracted by resoudre_demande_nutriments
+ * Draws come from the cell's own counter stream (cle = key of the generation)
+ */
+static void traiter_survie(AutomateCellulaire *automate, int position_cellule,
+                           int nombre_voisins_vivants, uint32_t cle) {
+    const EtatCellules *actuel = &automate->etat_actuel;
+    EtatCellules *suivant = &automate->etat_suivant;
+    const TraitsCellules *traits = &automate->traits;
+    const EnvironnementCellules *environnement = &automate->environnement;
+    uint8_t age_actuel = actuel->age[position_cellule];
+    uint8_t sante_actuelle = actuel->sante[position_cellule];
+    FluxAleatoire flux = ouvrir_flux(cle, position_origine(automate, position_cellule), 0);
+    uint32_t generateur;
+    
+    // Morte par défaut, jusqu'à preuve de survie ; rien de consommé
+    suivant->vivante[position_cellule] = 0;
+    automate->demande_nutriments[position_cellule] = 0;
+    
+    // VIEILLISSEMENT ACCÉLÉRÉ POUR EMPÊCHER STABILITÉ
+    // Vieillissement normal
+    uint8_t increment_age = 1;
+    
+    // Accélération du vieillissement pour les cellules anciennes
+    if (age_actuel > ACCELERATION_VIEILLISSEMENT) {
+        increment_age = FACTEUR_ACCELERATION;
+    }
+    
+    uint8_t age_suivant = age_actuel + increment_age;
+    uint8_t sante_suivante = 0;
+    
+    // Mort de vieillesse
+    if (age_suivant >= AGE_MAXIMUM) {
+        return;  // Reste morte
+    }
+    
+    // Consommation de base
+    int consommation_base = CONSOMMATION_NUTRIMENTS;
+    
+    // Compétition naturelle pour les ressources (biologie réaliste)
+    if (nombre_voisins_vivants >= SEUIL_COMPETITION) {
+        // En cas de compétition, chaque cellule accède à moins de ressources
+        int ressources_disponibles = (int)diviser_petit(environnement->nutriments[position_cellule], 1 + nombre_voisins_vivants / 2);
+        if (ressources_disponibles >= consommation_base) {
+            automate->demande_nutriments[position_cellule] = consommation_base;
+            sante_suivante = sante_actuelle; // Stable mais pas d'amélioration
+            // Léger stress de compétition
+            if (sante_suivante > STRESS_COMPETITION) {
+                sante_suivante -= STRESS_COMPETITION;
+            }
+        } else {
+            // Ressources insuffisantes en compétition
+            sante_suivante = (sante_actuelle > 3) ? sante_actuelle - 3 : 0;
+        }
+    } else {
+        // Pas de compétition : croissance normale
+        if (environnement->nutriments[position_cellule] >= consommation_base) {
+            automate->demande_nutriments[position_cellule] = consommation_base;
+            sante_suivante = (sante_actuelle < 100) ? sante_actuelle + 1 : 100;
+        } else {
+            // Malnutrition légère
+            sante_suivante = (sante_actuelle > 2) ? sante_actuelle - 2 : 0;
+        }
+    }
+    
+    // Vieillissement naturel (perte progressive avec l'âge)
+    if (age_suivant > FERTILITE_DECLIN) {
+        int perte_age = (age_suivant - FERTILITE_DECLIN) / 20;  // Vieillissement progressif
+        sante_suivante = (sante_suivante > perte_age) ? 
+                         sante_suivante - perte_age : 0;
+    }
+    
+    // === REALISTIC BIOLOGICAL SURVIVAL FACTORS ===
+    
+    // Disease mortality check (epidemiological realism)
+    // Survival probability resistance / (risk + 0.1), both over 255: the uniform
+    // draw u = bits / 65536 kills when u x (2 risk + 51) > 2 resistance
+    if (environnement->pathogenes_present[position_cellule] > 0) {
+        generateur = tirer_flux(&flux);
+        uint32_t resistance_disease = traits->resistance_maladie[position_cellule];
+        uint32_t risk_disease = environnement->pathogenes_present[position_cellule];
+        
+        if (TIRAGE_PRINCIPAL(generateur) * (2 * risk_disease + 51) > (resistance_disease << 17)) {
+            return;  // Death by disease
+        }
+    }
+    
+    // Predation mortality check (predator-prey dynamics)
+    // Escape probability camouflage / 255, only when the risk exceeds 0.2
+    if (environnement->pression_predation[position_cellule] > 0) {
+        generateur = tirer_flux(&flux);
+        uint32_t camouflage_effectiveness = traits->camouflage_predation[position_cellule];
+        
+        if (TIRAGE_PRINCIPAL(generateur) * 255 > (camouflage_effectiveness << 16) &&
+            environnement->pression_predation[position_cellule] > Q8(0.2)) {
+            return;  // Death by predation
+        }
+    }
+    
+    // Environmental toxicity effects
+    if (environnement->toxicite_locale[position_cellule] > 100) {
+        sante_suivante = (sante_suivante > 2) ? sante_suivante - 2 : 0;
+    }
+    
+    // Basic malnutrition check (more permissive)
+    if (sante_suivante < 1) {
+        return;  // Death by starvation
+    }
+    
+    // INSTABILITÉ GÉNÉTIQUE PROGRESSIVE 
+    // L'instabilité augmente avec l'âge et les générations pour empêcher les structures stables
+    uint32_t instabilite_totale = 0;
+    if (age_suivant > SEUIL_INSTABILITE_AGE) {
+        instabilite_totale += (age_suivant - SEUIL_INSTABILITE_AGE) / 10;
+    }
+    instabilite_totale += automate->generation_actuelle / DIVISEUR_INSTABILITE;  // Très réduit
+    
+    // Chance de mutation spontanée progressive (très réduite)
+    generateur = tirer_flux(&flux);
+    if (tirer_borne(TIRAGE_PRINCIPAL(generateur), 1000) < instabilite_totale) {  // Changé de % 100 à % 1000 pour réduire drastiquement
+        // Instabilité : survie/mort aléatoire qui brise les patterns stables
+        if (tirer_borne(TIRAGE_SECONDAIRE(generateur), 100) < 10) {  // Réduit de 30% à 10% de chance de mort spontanée
+            return;  // Mort par instabilité génétique
+        }
+    }
+    
+    // MORTALITÉ FORCÉE PAR HAUTE DENSITÉ LOCALE
+    // Empêche les blocs stables en forçant la mort en zones denses
+    if (nombre_voisins_vivants >= SEUIL_DENSITE_FATALE) {
+        generateur = tirer_flux(&flux);
+        if (tirer_borne(TIRAGE_PRINCIPAL(generateur), 100) < CHANCE_MORT_DENSITE) {
+            return;  // Mort par surpopulation locale
+        }
+    }
+    
+    // Survie ! (la règle a été vérifiée en amont, voir table_transition)
+    // Les traits froids restent en place, seul l'état chaud avance
+    suivant->vivante[position_cellule] = 1;
+    suivant->age[position_cellule] = age_suivant;
+    suivant->sante[position_cellule] = sante_suivante;
+    suivant->compteur_mouvement[position_cellule] = actuel->compteur_mouvement[position_cellule] + 1;
+}
+
+/**
+ * Birth branch for a dead cell whose neighbor count the birth rule accepts
+ * (see table_transition): fitness-weighted reproduction probability,
+ * then multi-trait inheritance with stress-adaptive mutations
+ * Traits of the newborn are written in place: a dead site is never read as a parent
+ * Parents are only gathered when nutrients allow a birth
+ * Draws come from the cell's own counter stream and the birth cost is recorded
+ * as a demand, as in traiter_survie
+ */
+static void traiter_naissance(AutomateCellulaire *automate, int ligne, int colonne,
+                              int nombre_voisins_vivants, uint32_t cle) {
+    int largeur = automate->largeur_grille;
+    int position_cellule = ligne * largeur + colonne;
+    int position_grille = position_origine(automate, position_cellule);
+    EtatCellules *suivant = &automate->etat_suivant;
+    TraitsCellules *traits = &automate->traits;
+    const EnvironnementCellules *environnement = &automate->environnement;
+    VoisinageCellule voisinage;
+    const uint32_t *positions_parents = voisinage.positions_parents;
+    FluxAleatoire flux = ouvrir_flux(cle, position_grille, 0);
+    uint32_t generateur;
+    
+    // Reste morte sauf naissance
+    suivant->vivante[position_cellule] = 0;
+    automate->demande_nutriments[position_cellule] = 0;
+    
+    // CONDITIONS ÉVOLUTIVES DE REPRODUCTION AVEC FITNESS DIFFÉRENTIEL
+    if (environnement->nutriments[position_cellule] < (CONSOMMATION_NUTRIMENTS * 2)) return;
+    
+    collecter_parents_fertiles(automate, ligne, colonne, &voisinage);
+    int nombre_parents_fertiles = voisinage.nombre_parents_fertiles;
+    
+    if (nombre_parents_fertiles >= 1) {
+        // Calcul du fitness moyen des parents (pression de sélection)
+        // Les termes propres aux parents sont en cache, seule la niche de l'enfant reste à appliquer
+        uint32_t fitness_total = 0;
+        uint32_t fertilite_total = 0;
+        uint32_t niche_factor = automate->niche_ecologique[position_cellule];
+        
+        for (int i = 0; i < nombre_parents_fertiles; i++) {
+            const CacheParent *parent = &automate->cache_parents[positions_parents[i]];
+            fertilite_total += parent->fertilite;
+            fitness_total += calculer_fitness_evolutif(&automate->cycles, parent, niche_factor);
+        }
+        
+        uint32_t fitness_moyen = diviser_petit(fitness_total, nombre_parents_fertiles);  // 0-255
+        uint32_t fertilite_moyenne = diviser_petit(fertilite_total, nombre_parents_fertiles);  // Q8
+        
+        // Bonus de fitness : meilleurs parents = plus de descendants (0.5 + 0.5 x fitness / 255, en Q8)
+        uint32_t probabilite_naissance = fertilite_moyenne * (128 + ((fitness_moyen * 257) >> 9));  // Q16
+        
+        // Appliquer les règles de naissance
+        generateur = tirer_flux(&flux);
+        
+        if (TIRAGE_PRINCIPAL(generateur) < probabilite_naissance) {
+            
+            // NAISSANCE avec dispersion !
+            // Traits des parents sommés en une passe, chaque héritage n'a plus qu'à diviser
+            SommesHeritees sommes;
+            sommer_traits_parents(automate, positions_parents, nombre_parents_fertiles, &sommes);
+            
+            // Héritage de l'âge des parents avec moins de pénalité
+            uint8_t age_herite = calculer_age_herite(&sommes, nombre_parents_fertiles, &flux);
+            
+            // HÉRITAGE DE RACE ET POLARISATION
+            traits->race[position_cellule] = (uint8_t)calculer_race_herite(&sommes, nombre_parents_fertiles, &flux);
+            traits->polarisation[position_cellule] = (uint8_t)calculer_polarisation_herite(&sommes, nombre_parents_fertiles, &flux);
+            traits->force_polarisation[position_cellule] = FORCE_POLARISATION_INITIALE + tirer_borne(TIRAGE_PRINCIPAL(tirer_flux(&flux)), 64);
+            
+            // HÉRITAGE DES TRAITS ÉVOLUTIFS AVEC MUTATIONS
+            // Fitness reproductif : moyenne des parents + mutation
+            uint32_t fitness_herite = diviser_petit(sommes.fitness_reproductif, nombre_parents_fertiles);
+            uint32_t efficacite_herite = diviser_petit(sommes.efficacite_energetique, nombre_parents_fertiles);
+            
+            // === REALISTIC EVOLUTIONARY MUTATIONS WITH STRESS ADAPTATION ===
+            
+            // Calculate environmental stress level (Q8) for mutation rate adaptation
+            uint32_t stress_level = (environnement->pathogenes_present[position_cellule] * Q8(0.3) +
+                                     environnement->pression_predation[position_cellule] * Q8(0.4) +
+                                     environnement->toxicite_locale[position_cellule] * Q8(0.2)) >> 8;
+            stress_level += (nombre_voisins_vivants > MIGRATION_PRESSURE_THRESHOLD) ? Q8(0.1) : 0;
+            
+            // Adaptive mutation rate: higher under stress (realistic biological response)
+            uint32_t taux_mutation_adaptatif = BASE_MUTATION_RATE + 
+                                              ((stress_level * STRESS_MUTATION_MULTIPLIER) >> 8);
+            
+            // Fitness evolution with stress-adaptive mutations
+            generateur = tirer_flux(&flux);
+            if (tirer_borne(TIRAGE_PRINCIPAL(generateur), 100) < taux_mutation_adaptatif) {
+                int mutation_fitness = (int)tirer_borne(TIRAGE_SECONDAIRE(generateur), 21) - 10;  // -10 à +10
+                fitness_herite = (fitness_herite + mutation_fitness < 0) ? 0 : 
+                               (fitness_herite + mutation_fitness > 255) ? 255 : 
+                               fitness_herite + mutation_fitness;
+            }
+            
+            // Energy efficiency evolution
+            generateur = tirer_flux(&flux);
+            if (tirer_borne(TIRAGE_PRINCIPAL(generateur), 100) < taux_mutation_adaptatif) {
+                int mutation_efficacite = (int)tirer_borne(TIRAGE_SECONDAIRE(generateur), 21) - 10;
+                efficacite_herite = (efficacite_herite + mutation_efficacite < 0) ? 0 : 
+                                  (efficacite_herite + mutation_efficacite > 255) ? 255 : 
+                                  efficacite_herite + mutation_efficacite;
+            }
+            
+            // === BIOLOGICAL TRAIT INHERITANCE WITH EVOLUTION ===
+            
+            // Disease resistance inheritance (crucial for epidemic survival)
+            uint32_t resistance_moyenne = diviser_petit(sommes.resistance_maladie, nombre_parents_fertiles);
+            
+            generateur = tirer_flux(&flux);
+            if (tirer_borne(TIRAGE_PRINCIPAL(generateur), 100) < RESISTANCE_EVOLUTION_RATE) {
+                int mutation_resistance = (int)tirer_borne(TIRAGE_SECONDAIRE(generateur), 31) - 15;  // -15 to +15
+                resistance_moyenne = (resistance_moyenne + mutation_resistance < 0) ? 0 :
+                                   (resistance_moyenne + mutation_resistance > 255) ? 255 :
+                                   resistance_moyenne + mutation_resistance;
+            }
+            
+            // Predation camouflage inheritance
+            uint32_t camouflage_moyen = diviser_petit(sommes.camouflage_predation, nombre_parents_fertiles);
+            
+            generateur = tirer_flux(&flux);
+            if (tirer_borne(TIRAGE_PRINCIPAL(generateur), 100) < taux_mutation_adaptatif) {
+                int mutation_camouflage = (int)tirer_borne(TIRAGE_SECONDAIRE(generateur), 21) - 10;
+                camouflage_moyen = (camouflage_moyen + mutation_camouflage < 0) ? 0 :
+                                 (camouflage_moyen + mutation_camouflage > 255) ? 255 :
+                                 camouflage_moyen + mutation_camouflage;
+            }
+            
+            // Set all inherited traits
+            traits->fitness_reproductif[position_cellule] = (uint8_t)fitness_herite;
+            traits->efficacite_energetique[position_cellule] = (uint8_t)efficacite_herite;
+            traits->resistance_maladie[position_cellule] = (uint8_t)resistance_moyenne;
+            traits->camouflage_predation[position_cellule] = (uint8_t)camouflage_moyen;
+            traits->territorialite[position_cellule] = (traits->territorialite[positions_parents[0]] + 
+                                                       ((int)tirer_borne(TIRAGE_PRINCIPAL(generateur), 21) - 10)) % 256;
+            traits->adaptabilite_stress[position_cellule] = (traits->adaptabilite_stress[positions_parents[0]] + 
+                                                            (int)tirer_borne(TIRAGE_SECONDAIRE(generateur), 21) - 10) % 256;
+            traits->generation_naissance[position_cellule] = (uint8_t)(automate->generation_actuelle % 256);
+            traits->espece_id[position_cellule] = determiner_espece(positions_parents, nombre_parents_fertiles, 
+                                                                   colonne, position_grille / largeur, largeur,
+                                                                   hauteur_grille_origine(automate));
+            
+            // DISPERSION : Les descendants ont tendance à éviter la surpopulation
+            // En zone dense, réduire la probabilité de reproduction
+            if (nombre_voisins_vivants >= 3) {
+                generateur = tirer_flux(&flux);
+                if (tirer_borne(TIRAGE_PRINCIPAL(generateur), 100) < 60) {  // 60% de chance d'échec en zone dense
+                    return;
                 }
-                
-            } else {
-                // ===== CELLULE MORTE : NAISSANCE ? =====
-                
-                // CONDITIONS ÉVOLUTIVES DE REPRODUCTION AVEC FITNESS DIFFÉRENTIEL
-                if (nombre_parents_fertiles >= 1 && environnement->nutriments >= (CONSOMMATION_NUTRIMENTS * 2)) {
-                    
-                    // Calcul du fitness moyen des parents (pression de sélection)
-                    float fitness_total = 0.0f;
-                    float fertilite_total = 0.0f;
-                    
-                    for (int i = 0; i < nombre_parents_fertiles; i++) {
-                        float fertilite = calculer_fertilite(voisins_parents[i]->age);
-                        uint8_t fitness_parent = calculer_fitness_evolutif(voisins_parents[i], 
-                                                                         colonne, ligne, 
-                                                                         automate->generation_actuelle,
-                                                                         largeur, hauteur);
-                        fitness_total += (float)fitness_parent / 255.0f;
-                        fertilite_total += fertilite;
-                    }
-                    
-                    float fitness_moyen = fitness_total / nombre_parents_fertiles;
-                    float probabilite_naissance = fertilite_total / nombre_parents_fertiles;
-                    
-                    // Bonus de fitness : meilleurs parents = plus de descendants
-                    probabilite_naissance *= (0.5f + 0.5f * fitness_moyen);
-                    
-                    // Appliquer les règles de naissance
-                    generateur = generateur * 1103515245u + 12345u;
-                    float seuil_naissance = (float)(generateur % 1000) / 1000.0f;
-                    
-                    if ((automate->masque_conditions_naissance & (1u << nombre_voisins_vivants)) && 
-                        seuil_naissance < probabilite_naissance) {
-                        
-                        // NAISSANCE avec dispersion !
-                        cellule_suivante->vivante = 1;
-                        
-                        // Héritage de l'âge des parents avec moins de pénalité
-                        cellule_suivante->age = calculer_age_herite(voisins_parents, nombre_parents_fertiles, &generateur);
-                        
-                        // HÉRITAGE DE RACE ET POLARISATION
-                        cellule_suivante->race = calculer_race_herite(voisins_parents, nombre_parents_fertiles, &generateur);
-                        cellule_suivante->polarisation = calculer_polarisation_herite(voisins_parents, nombre_parents_fertiles, &generateur);
-                        cellule_suivante->force_polarisation = FORCE_POLARISATION_INITIALE + (generateur % 64);
-                        cellule_suivante->compteur_mouvement = 0;
-                        
-                        // HÉRITAGE DES TRAITS ÉVOLUTIFS AVEC MUTATIONS
-                        // Fitness reproductif : moyenne des parents + mutation
-                        uint32_t fitness_herite = 0;
-                        uint32_t efficacite_herite = 0;
-                        for (int i = 0; i < nombre_parents_fertiles; i++) {
-                            fitness_herite += voisins_parents[i]->fitness_reproductif;
-                            efficacite_herite += voisins_parents[i]->efficacite_energetique;
-                        }
-                        fitness_herite /= nombre_parents_fertiles;
-                        efficacite_herite /= nombre_parents_fertiles;
-                        
-                        // === REALISTIC EVOLUTIONARY MUTATIONS WITH STRESS ADAPTATION ===
-                        
-                        // Calculate environmental stress level for mutation rate adaptation
-                        float stress_level = 0.0f;
-                        stress_level += (float)environnement->pathogenes_present / 255.0f * 0.3f;
-                        stress_level += (float)environnement->pression_predation / 255.0f * 0.4f;
-                        stress_level += (float)environnement->toxicite_locale / 255.0f * 0.2f;
-                        stress_level += (nombre_voisins_vivants > MIGRATION_PRESSURE_THRESHOLD) ? 0.1f : 0.0f;
-                        
-                        // Adaptive mutation rate: higher under stress (realistic biological response)
-                        uint32_t taux_mutation_adaptatif = BASE_MUTATION_RATE + 
-                                                          (uint32_t)(stress_level * STRESS_MUTATION_MULTIPLIER);
-                        
-                        // Fitness evolution with stress-adaptive mutations
-                        generateur = generateur * 1103515245u + 12345u;
-                        if ((generateur % 100) < taux_mutation_adaptatif) {
-                            int mutation_fitness = ((generateur >> 8) % 21) - 10;  // -10 à +10
-                            fitness_herite = (fitness_herite + mutation_fitness < 0) ? 0 : 
-                                           (fitness_herite + mutation_fitness > 255) ? 255 : 
-                                           fitness_herite + mutation_fitness;
-                        }
-                        
-                        // Energy efficiency evolution
-                        generateur = generateur * 1103515245u + 12345u;
-                        if ((generateur % 100) < taux_mutation_adaptatif) {
-                            int mutation_efficacite = ((generateur >> 8) % 21) - 10;
-                            efficacite_herite = (efficacite_herite + mutation_efficacite < 0) ? 0 : 
-                                              (efficacite_herite + mutation_efficacite > 255) ? 255 : 
-                                              efficacite_herite + mutation_efficacite;
-                        }
-                        
-                        // === BIOLOGICAL TRAIT INHERITANCE WITH EVOLUTION ===
-                        
-                        // Disease resistance inheritance (crucial for epidemic survival)
-                        uint32_t resistance_moyenne = 0;
-                        for (int i = 0; i < nombre_parents_fertiles; i++) {
-                            resistance_moyenne += voisins_parents[i]->resistance_maladie;
-                        }
-                        resistance_moyenne /= nombre_parents_fertiles;
-                        
-                        generateur = generateur * 1103515245u + 12345u;
-                        if ((generateur % 100) < RESISTANCE_EVOLUTION_RATE) {
-                            int mutation_resistance = ((generateur >> 8) % 31) - 15;  // -15 to +15
-                            resistance_moyenne = (resistance_moyenne + mutation_resistance < 0) ? 0 :
-                                               (resistance_moyenne + mutation_resistance > 255) ? 255 :
-                                               resistance_moyenne + mutation_resistance;
-                        }
-                        
-                        // Predation camouflage inheritance
-                        uint32_t camouflage_moyen = 0;
-                        for (int i = 0; i < nombre_parents_fertiles; i++) {
-                            camouflage_moyen += voisins_parents[i]->camouflage_predation;
-                        }
-                        camouflage_moyen /= nombre_parents_fertiles;
-                        
-                        generateur = generateur * 1103515245u + 12345u;
-                        if ((generateur % 100) < taux_mutation_adaptatif) {
-                            int mutation_camouflage = ((generateur >> 8) % 21) - 10;
-                            camouflage_moyen = (camouflage_moyen + mutation_camouflage < 0) ? 0 :
-                                             (camouflage_moyen + mutation_camouflage > 255) ? 255 :
-                                             camouflage_moyen + mutation_camouflage;
-                        }
-                        
-                        // Set all inherited traits
-                        cellule_suivante->fitness_reproductif = (uint8_t)fitness_herite;
-                        cellule_suivante->efficacite_energetique = (uint8_t)efficacite_herite;
-                        cellule_suivante->resistance_maladie = (uint8_t)resistance_moyenne;
-                        cellule_suivante->camouflage_predation = (uint8_t)camouflage_moyen;
-                        cellule_suivante->territorialite = (voisins_parents[0]->territorialite + 
-                                                          ((generateur % 21) - 10)) % 256;
-                        cellule_suivante->adaptabilite_stress = (voisins_parents[0]->adaptabilite_stress + 
-                                                               ((generateur >> 8) % 21) - 10) % 256;
-                        cellule_suivante->generation_naissance = (uint8_t)(automate->generation_actuelle % 256);
-                        cellule_suivante->espece_id = determiner_espece(voisins_parents, nombre_parents_fertiles, 
-                                                                       colonne, ligne, largeur, hauteur);
-                        
-                        // DISPERSION : Les descendants ont tendance à éviter la surpopulation
-                        // En zone dense, réduire la probabilité de reproduction
-                        if (nombre_voisins_vivants >= 3) {
-                            generateur = generateur * 1103515245u + 12345u;
-                            if ((generateur % 100) < 60) {  // 60% de chance d'échec en zone dense
-                                cellule_suivante->vivante = 0;
-                                continue;
-                            }
-                        }
-                        
-                        // Héritage génétique avec diversification forcée
-                        uint8_t genotype_moyen_survie = 0;
-                        uint8_t genotype_moyen_naissance = 0;
-                        for (int i = 0; i < nombre_parents_fertiles; i++) {
-                            genotype_moyen_survie += voisins_parents[i]->genotype_survie;
-                            genotype_moyen_naissance += voisins_parents[i]->genotype_naissance;
-                        }
-                        genotype_moyen_survie /= nombre_parents_fertiles;
-                        genotype_moyen_naissance /= nombre_parents_fertiles;
-                        
-                        // Augmenter les mutations en zones de compétition pour favoriser l'adaptation
-                        uint32_t taux_mutation_local = TAUX_MUTATION;
-                        if (nombre_voisins_vivants >= SEUIL_COMPETITION) {
-                            taux_mutation_local *= 2;  // Double mutation en compétition
-                        }
-                        
-                        // Application avec taux adaptatif
-                        generateur = generateur * 1103515245u + 12345u;
-                        if ((generateur % 100) < taux_mutation_local) {
-                            int mutation_survie = ((generateur >> 8) % 41) - 20;  // -20 à +20
-                            int mutation_naissance = ((generateur >> 16) % 41) - 20;
-                            genotype_moyen_survie = (genotype_moyen_survie + mutation_survie < 0) ? 0 : 
-                                                  (genotype_moyen_survie + mutation_survie > 255) ? 255 : 
-                                                  genotype_moyen_survie + mutation_survie;
-                            genotype_moyen_naissance = (genotype_moyen_naissance + mutation_naissance < 0) ? 0 : 
-                                                     (genotype_moyen_naissance + mutation_naissance > 255) ? 255 : 
-                                                     genotype_moyen_naissance + mutation_naissance;
-                        }
-                        
-                        cellule_suivante->genotype_survie = genotype_moyen_survie;
-                        cellule_suivante->genotype_naissance = genotype_moyen_naissance;
-                        
-                        // Santé initiale
-                        cellule_suivante->sante = 50;  // Commence en bonne santé
-                        
-                        // Consommer les nutriments pour la naissance (coût réaliste)
-                        environnement->nutriments -= (CONSOMMATION_NUTRIMENTS * 2);
-                        
-                        automate->population_totale++;
-                    }
+            }
+            
+            // Héritage génétique avec diversification forcée
+            uint8_t genotype_moyen_survie = (uint8_t)diviser_petit(sommes.genotype_survie, nombre_parents_fertiles);
+            uint8_t genotype_moyen_naissance = (uint8_t)diviser_petit(sommes.genotype_naissance, nombre_parents_fertiles);
+            
+            // Augmenter les mutations en zones de compétition pour favoriser l'adaptation
+            uint32_t taux_mutation_local = TAUX_MUTATION;
+            if (nombre_voisins_vivants >= SEUIL_COMPETITION) {
+                taux_mutation_local *= 2;  // Double mutation en compétition
+            }
+            
+            // Application avec taux adaptatif
+            generateur = tirer_flux(&flux);
+            if (tirer_borne(TIRAGE_PRINCIPAL(generateur), 100) < taux_mutation_local) {
+                int mutation_survie = (int)tirer_borne(TIRAGE_SECONDAIRE(generateur), 41) - 20;  // -20 à +20
+                int mutation_naissance = (int)tirer_borne(TIRAGE_TERTIAIRE(generateur), 41) - 20;
+                genotype_moyen_survie = (genotype_moyen_survie + mutation_survie < 0) ? 0 : 
+                                      (genotype_moyen_survie + mutation_survie > 255) ? 255 : 
+                                      genotype_moyen_survie + mutation_survie;
+                genotype_moyen_naissance = (genotype_moyen_naissance + mutation_naissance < 0) ? 0 : 
+                                         (genotype_moyen_naissance + mutation_naissance > 255) ? 255 : 
+                                         genotype_moyen_naissance + mutation_naissance;
+            }
+            
+            traits->genotype_survie[position_cellule] = genotype_moyen_survie;
+            traits->genotype_naissance[position_cellule] = genotype_moyen_naissance;
+            
+            // État chaud du nouveau-né : santé initiale, compteur de mouvement à zéro
+            suivant->vivante[position_cellule] = 1;
+            suivant->age[position_cellule] = age_herite;
+            suivant->sante[position_cellule] = 50;  // Commence en bonne santé
+            suivant->compteur_mouvement[position_cellule] = 0;
+            
+            // Consommer les nutriments pour la naissance (coût réaliste)
+            automate->demande_nutriments[position_cellule] = CONSOMMATION_NUTRIMENTS * 2;
+        }
+    }
+}
+
+/**
+ * Resolve phase of the nutrient accounting on the sites [debut, fin): subtracts
+ * from each site what its cell recorded during the update. A cell only asks for
+ * the nutrients of its own site and only when they suffice, so no site can go
+ * below zero, and the sites can be resolved in any order once updated
+ */
+static void resoudre_demande_nutriments(AutomateCellulaire *automate, int debut, int fin) {
+    uint8_t *nutriments = automate->environnement.nutriments;
+    const uint8_t *demande = automate->demande_nutriments;
+    
+    int debut_scalaire = debut;
+#if SSE2_COMPILABLE
+    if (noyau_sse2_actif) debut_scalaire = resoudre_demande_nutriments_sse2(automate, debut, fin);
+#endif
+    
+    for (int position = debut_scalaire; position < fin; position++) {
+        nutriments[position] -= demande[position];
+    }
+}
+
+// Copie une cellule complète (état chaud + traits froids) d'une position à une autre
+static void copier_cellule(AutomateCellulaire *automate, int source, int destination) {
+    EtatCellules *etat = &automate->etat_actuel;
+    TraitsCellules *traits = &automate->traits;
+    
+    etat->vivante[destination] = etat->vivante[source];
+    etat->age[destination] = etat->age[source];
+    etat->sante[destination] = etat->sante[source];
+    etat->compteur_mouvement[destination] = etat->compteur_mouvement[source];
+    
+    traits->genotype_survie[destination] = traits->genotype_survie[source];
+    traits->genotype_naissance[destination] = traits->genotype_naissance[source];
+    traits->race[destination] = traits->race[source];
+    traits->polarisation[destination] = traits->polarisation[source];
+    traits->force_polarisation[destination] = traits->force_polarisation[source];
+    traits->fitness_reproductif[destination] = traits->fitness_reproductif[source];
+    traits->efficacite_energetique[destination] = traits->efficacite_energetique[source];
+    traits->espece_id[destination] = traits->espece_id[source];
+    traits->resistance_maladie[destination] = traits->resistance_maladie[source];
+    traits->camouflage_predation[destination] = traits->camouflage_predation[source];
+    traits->territorialite[destination] = traits->territorialite[source];
+    traits->adaptabilite_stress[destination] = traits->adaptabilite_stress[source];
+    traits->generation_naissance[destination] = traits->generation_naissance[source];
+}
+
+// Case visée par une cellule selon sa polarisation, -1 si le bord fixe la bloque
+static int cible_mouvement(const AutomateCellulaire *automate, int position_cellule) {
+    int largeur = automate->largeur_grille, hauteur = automate->hauteur_grille;
+    int delta_x, delta_y;
+    obtenir_coordonnees_direction((DirectionPolarisation)automate->traits.polarisation[position_cellule],
+                                  &delta_x, &delta_y);
+    
+    int nouvelle_ligne = position_cellule / largeur + delta_y;
+    int nouvelle_colonne = position_cellule % largeur + delta_x;
+    if (nouvelle_ligne < 0 || nouvelle_ligne >= hauteur ||
+        nouvelle_colonne < 0 || nouvelle_colonne >= largeur) {
+        if (automate->bord == BORD_FIXE) return -1;  // Le bord bloque le déplacement
+        nouvelle_ligne = (nouvelle_ligne < 0) ? hauteur - 1 : (nouvelle_ligne >= hauteur) ? 0 : nouvelle_ligne;
+        nouvelle_colonne = (nouvelle_colonne < 0) ? largeur - 1 : (nouvelle_colonne >= largeur) ? 0 : nouvelle_colonne;
+    }
+    return nouvelle_ligne * largeur + nouvelle_colonne;
+}
+
+// Source d'une réservation : la case d'où la polarisation "direction" mène à "cible"
+static int source_mouvement(const AutomateCellulaire *automate, int cible, int direction) {
+    int largeur = automate->largeur_grille, hauteur = automate->hauteur_grille;
+    int delta_x, delta_y;
+    obtenir_coordonnees_direction((DirectionPolarisation)direction, &delta_x, &delta_y);
+    
+    // Une cible n'est jamais au-delà d'un bord fixe : seul le tore fait le tour
+    int ligne = cible / largeur - delta_y, colonne = cible % largeur - delta_x;
+    ligne = (ligne < 0) ? hauteur - 1 : (ligne >= hauteur) ? 0 : ligne;
+    colonne = (colonne < 0) ? largeur - 1 : (colonne >= largeur) ? 0 : colonne;
+    return ligne * largeur + colonne;
+}
+
+// Ligne dont le bloc 3x3 touche les lignes [premiere_ligne, fin_lignes), par la jointure sur un tore
+static int ligne_touche_lignes(const AutomateCellulaire *automate, int ligne, int premiere_ligne, int fin_lignes) {
+    if (ligne >= premiere_ligne - 1 && ligne <= fin_lignes) return 1;
+    if (automate->bord != BORD_TORIQUE) return 0;
+    return (premiere_ligne == 0 && ligne == automate->hauteur_grille - 1) ||
+           (fin_lignes == automate->hauteur_grille && ligne == 0);
+}
+
+/**
+ * Intent of a living cell: its target when its race and counter allow a move,
+ * the target is empty before any move and the cell's movement draw says so;
+ * -1 otherwise
+ */
+static int intention_mouvement(const AutomateCellulaire *automate, int position_cellule, uint32_t cle) {
+    const EtatCellules *etat = &automate->etat_actuel;
+    if (!doit_se_deplacer(automate->traits.race[position_cellule], etat->compteur_mouvement[position_cellule], 0)) {
+        return -1;
+    }
+    
+    // Déplacer seulement si la case cible est libre
+    int nouvelle_position = cible_mouvement(automate, position_cellule);
+    if (nouvelle_position < 0 || etat->vivante[nouvelle_position]) return -1;
+    
+    // Effectuer le déplacement avec probabilité réduite
+    FluxAleatoire flux = ouvrir_flux(cle, position_origine(automate, position_cellule), EMPLACEMENT_MOUVEMENT);
+    if (tirer_borne(TIRAGE_PRINCIPAL(tirer_flux(&flux)), 100) >= 30) return -1;  // Seulement 30% de chance de bouger
+    return nouvelle_position;
+}
+
+/**
+ * New state of one cell: the table rules out most cells, the others go through
+ * the survival or birth branch
+ */
+static inline void calculer_cellule(AutomateCellulaire *automate, int ligne, int colonne, uint32_t cle) {
+    int position_cellule = ligne * automate->largeur_grille + colonne;
+    int vivante = automate->etat_actuel.vivante[position_cellule];
+    int nombre_voisins_vivants = automate->densite_voisinage[position_cellule] - vivante;
+    
+    if (!transition_possible(automate, vivante, nombre_voisins_vivants)) {
+        // La règle interdit l'état vivant (ou aucun voisin pour naître) :
+        // ni biologie ni tirage, la cellule est morte à la génération suivante
+        automate->etat_suivant.vivante[position_cellule] = 0;
+        automate->demande_nutriments[position_cellule] = 0;
+    } else if (vivante) {
+        // ===== CELLULE VIVANTE : SURVIE ? =====
+        traiter_survie(automate, position_cellule, nombre_voisins_vivants, cle);
+    } else {
+        // ===== CELLULE MORTE : NAISSANCE ? =====
+        traiter_naissance(automate, ligne, colonne, nombre_voisins_vivants, cle);
+    }
+}
+
+// Listes compactes d'un bloc de lignes : vivantes que la règle peut garder, et mortes
+// qui peuvent naître ; les naissances sont rangées à rebours depuis "naissances"
+typedef struct {
+    uint32_t *survivantes;
+    uint32_t nombre_survivantes;
+    uint32_t *naissances;
+    uint32_t nombre_naissances;
+} ListesMiseAJour;
+
+// 1 si l'une des 8 voisines porte un parent fertile (lecture dans la grille à halo)
+static inline int parent_fertile_autour(const AutomateCellulaire *automate, int ligne, int colonne) {
+    int largeur_halo = automate->largeur_grille + 2;
+    const uint8_t *haut = &automate->parents_potentiels[ligne * largeur_halo + colonne];
+    const uint8_t *milieu = haut + largeur_halo, *bas = milieu + largeur_halo;
+    return (haut[0] | haut[1] | haut[2] | milieu[0] | milieu[2] | bas[0] | bas[1] | bas[2]) != 0;
+}
+
+/**
+ * Sorting pass over the row "ligne", columns [debut, fin) (active tiles only):
+ * living cells the rule may keep go to the survival list, dead cells with a
+ * birth count and a fertile parent around to the birth list; every other cell
+ * is dead at the next generation and uses nothing. Blocks of four sites without
+ * any living cell around are settled with one load
+ */
+static void trier_segment(AutomateCellulaire *automate, int ligne, int debut, int fin, ListesMiseAJour *listes) {
+    int origine = ligne * automate->largeur_grille;
+    const uint8_t *vivante = automate->etat_actuel.vivante;
+    const uint8_t *densites = automate->densite_voisinage;
+    uint8_t *vivante_suivante = automate->etat_suivant.vivante;
+    uint8_t *demande = automate->demande_nutriments;
+    
+    for (int colonne = debut; colonne < fin; ) {
+        int position = origine + colonne;
+        if (colonne + 4 <= fin && *(const quatre_octets_u*)&densites[position] == 0) {
+            *(quatre_octets_u*)&vivante_suivante[position] = 0;
+            *(quatre_octets_u*)&demande[position] = 0;
+            colonne += 4;
+            continue;
+        }
+        
+        int est_vivante = vivante[position];
+        if (transition_possible(automate, est_vivante, densites[position] - est_vivante)) {
+            if (est_vivante) {
+                listes->survivantes[listes->nombre_survivantes++] = (uint32_t)position;
+                colonne++;
+                continue;
+            }
+            if (parent_fertile_autour(automate, ligne, colonne)) {
+                listes->naissances[-(int)++listes->nombre_naissances] = (uint32_t)position;
+                colonne++;
+                continue;
+            }
+        }
+        vivante_suivante[position] = 0;
+        demande[position] = 0;
+        colonne++;
+    }
+}
+
+// Tuiles inactives : aucune cellule vivante autour, tout reste mort sans rien consommer
+// (même avec B0, une naissance demande au moins un parent)
+static void vider_segment(AutomateCellulaire *automate, int ligne, int debut, int fin) {
+    int position = ligne * automate->largeur_grille + debut;
+    effacer_octets(&automate->etat_suivant.vivante[position], fin - debut);
+    effacer_octets(&automate->demande_nutriments[position], fin - debut);
+}
+
+// =============================
+// PHASE DE MOUVEMENT PAR LIGNES
+// =============================
+// Trois étapes séparées par une barrière, chacune sur des plages de lignes :
+// intentions des sources, réservations des cibles, déplacements. Une cellule bouge au
+// plus une fois par phase, seulement vers une case vide à son début, et une cible
+// disputée revient à la source de plus petite position de la grille entière.
+// densite_voisinage (libre une fois les cellules mises à jour) marque les sources,
+// etat_suivant.vivante (le tampon arrière) porte les réservations ; une grille
+// clairsemée les garde nuls entre deux générations, une grille dense les efface
+
+// Lignes de la part "part" sur "nombre_parts" : toute hauteur de grille se partage jusqu'à une ligne par part
+static void lignes_part(const AutomateCellulaire *automate, uint32_t part, uint32_t nombre_parts,
+                        int *premiere_ligne, int *fin_lignes) {
+    uint32_t hauteur = (uint32_t)automate->hauteur_grille;
+    *premiere_ligne = (int)(part * hauteur / nombre_parts);
+    *fin_lignes = (int)((part + 1) * hauteur / nombre_parts);
+}
+
+/**
+ * Intents of the sources of the rows [premiere_ligne, fin_lignes): flags the
+ * living cells that want to move (see intention_mouvement)
+ */
+static void lister_intentions(AutomateCellulaire *automate, int premiere_ligne, int fin_lignes, uint32_t cle) {
+    int largeur = automate->largeur_grille;
+    int debut_sites = premiere_ligne * largeur, fin_sites = fin_lignes * largeur;
+    const uint8_t *vivante = automate->etat_actuel.vivante;
+    uint8_t *intentions = automate->densite_voisinage;
+    
+    if (automate->mode_clairseme) {
+        for (uint32_t i = 0; i < automate->nombre_cellules_vivantes; i++) {
+            int position_cellule = (int)automate->cellules_vivantes[i];
+            if (position_cellule < debut_sites || position_cellule >= fin_sites) continue;
+            if (intention_mouvement(automate, position_cellule, cle) >= 0) intentions[position_cellule] = 1;
+        }
+        return;
+    }
+    
+    effacer_octets(&intentions[debut_sites], fin_sites - debut_sites);
+    effacer_octets(&automate->etat_suivant.vivante[debut_sites], fin_sites - debut_sites);
+    for (int debut = debut_sites; debut < fin_sites; debut += 4) {
+        // Les blocs de quatre sites vides sont sautés d'une lecture
+        int fin = (debut + 4 <= fin_sites) ? debut + 4 : fin_sites;
+        if (fin - debut == 4 && *(const quatre_octets_u*)&vivante[debut] == 0) continue;
+        
+        for (int position_cellule = debut; position_cellule < fin; position_cellule++) {
+            if (vivante[position_cellule] && intention_mouvement(automate, position_cellule, cle) >= 0) {
+                intentions[position_cellule] = 1;
+            }
+        }
+    }
+}
+
+/**
+ * Claim of one flagged source whose target lies in the rows [premiere_ligne,
+ * fin_lignes): the mark of a target is the direction of its current winner plus
+ * one, and the lower source of the whole grid (position_origine) replaces it, so
+ * the sources may come in any order. A target claimed for the first time joins
+ * "cibles"; returns their number
+ */
+static uint32_t reserver_cible(AutomateCellulaire *automate, int source, int premiere_ligne, int fin_lignes,
+                               uint32_t *cibles, uint32_t nombre_cibles) {
+    uint8_t *reservations = automate->etat_suivant.vivante;
+    int cible = cible_mouvement(automate, source);
+    int ligne = cible / automate->largeur_grille;
+    if (ligne < premiere_ligne || ligne >= fin_lignes) return nombre_cibles;
+    
+    uint8_t marque = (uint8_t)(automate->traits.polarisation[source] + 1);
+    if (!reservations[cible]) {
+        reservations[cible] = marque;
+        cibles[nombre_cibles++] = (uint32_t)cible;
+    } else if (position_origine(automate, source) <
+               position_origine(automate, source_mouvement(automate, cible, reservations[cible] - 1))) {
+        reservations[cible] = marque;
+    }
+    return nombre_cibles;
+}
+
+/**
+ * Claims on the targets of the rows [premiere_ligne, fin_lignes): only the flagged
+ * sources of these rows and of the rows next to them can reach them. The claimed
+ * targets are listed in the part's own rows of cellules_mobiles; returns their number
+ */
+static uint32_t reserver_cibles(AutomateCellulaire *automate, int premiere_ligne, int fin_lignes) {
+    int largeur = automate->largeur_grille, hauteur = automate->hauteur_grille;
+    const uint8_t *intentions = automate->densite_voisinage;
+    uint32_t *cibles = automate->cellules_mobiles + premiere_ligne * largeur;
+    uint32_t nombre_cibles = 0;
+    
+    if (automate->mode_clairseme) {
+        for (uint32_t i = 0; i < automate->nombre_cellules_vivantes; i++) {
+            int source = (int)automate->cellules_vivantes[i];
+            if (!intentions[source] || !ligne_touche_lignes(automate, source / largeur, premiere_ligne, fin_lignes)) {
+                continue;
+            }
+            nombre_cibles = reserver_cible(automate, source, premiere_ligne, fin_lignes, cibles, nombre_cibles);
+        }
+        return nombre_cibles;
+    }
+    
+    for (int ligne = 0; ligne < hauteur; ligne++) {
+        if (!ligne_touche_lignes(automate, ligne, premiere_ligne, fin_lignes)) continue;
+        int fin_ligne = (ligne + 1) * largeur;
+        for (int debut = ligne * largeur; debut < fin_ligne; debut += 4) {
+            int fin = (debut + 4 <= fin_ligne) ? debut + 4 : fin_ligne;
+            if (fin - debut == 4 && *(const quatre_octets_u*)&intentions[debut] == 0) continue;
+            
+            for (int source = debut; source < fin; source++) {
+                if (!intentions[source]) continue;
+                nombre_cibles = reserver_cible(automate, source, premiere_ligne, fin_lignes, cibles, nombre_cibles);
+            }
+        }
+    }
+    return nombre_cibles;
+}
+
+/**
+ * Moves into the "nombre_cibles" targets claimed in the rows starting at
+ * premiere_ligne (see reserver_cibles): each winner is copied, its old site
+ * emptied and the claim mark cleared. A source only wins one target and targets
+ * were empty, so no move reads what another one writes
+ */
+static void deplacer_vers_cibles(AutomateCellulaire *automate, int premiere_ligne, uint32_t nombre_cibles) {
+    EtatCellules *etat = &automate->etat_actuel;
+    TraitsCellules *traits = &automate->traits;
+    uint8_t *reservations = automate->etat_suivant.vivante;
+    const uint32_t *cibles = automate->cellules_mobiles + premiere_ligne * automate->largeur_grille;
+    
+    for (uint32_t i = 0; i < nombre_cibles; i++) {
+        int nouvelle_position = (int)cibles[i];
+        int position_cellule = source_mouvement(automate, nouvelle_position, reservations[nouvelle_position] - 1);
+        reservations[nouvelle_position] = 0;
+        copier_cellule(automate, position_cellule, nouvelle_position);
+        
+        // Vider l'ancienne position
+        etat->vivante[position_cellule] = 0;
+        etat->age[position_cellule] = 0;
+        etat->sante[position_cellule] = 0;
+        traits->race[position_cellule] = RACE_EXPLORATRICE;
+        traits->polarisation[position_cellule] = DIRECTION_NORD;
+        traits->force_polarisation[position_cellule] = 0;
+        etat->compteur_mouvement[position_cellule] = 0;
+    }
+}
+
+// =============================
+// GÉNÉRATIONS CLAIRSEMÉES (LISTE DES CELLULES VIVANTES)
+// =============================
+// Tant que la population reste sous POPULATION_MAX_CLAIRSEMEE, une génération ne
+// parcourt que la liste des vivantes et leurs voisines (les candidates) au lieu de la
+// grille. Les tableaux par position restent le stockage des cellules ; entre deux
+// générations, densite_voisinage, parents_potentiels et etat_suivant.vivante sont nuls
+// partout, ce qui permet de les remplir et de les vider par la liste.
+
+/**
+ * Writes a parent mark in the haloed grid, with its copies in the halo rows and
+ * columns on a torus (same cells as construire_plan_occupation fills)
+ */
+static void ecrire_parent_halo(AutomateCellulaire *automate, int ligne, int colonne, uint8_t valeur) {
+    int largeur = automate->largeur_grille, hauteur = automate->hauteur_grille;
+    int largeur_halo = largeur + 2;
+    int lignes[3] = { ligne + 1 }, colonnes[3] = { colonne + 1 };
+    int nombre_lignes = 1, nombre_colonnes = 1;
+    
+    if (automate->bord == BORD_TORIQUE) {
+        if (ligne == hauteur - 1) lignes[nombre_lignes++] = 0;
+        if (ligne == 0) lignes[nombre_lignes++] = hauteur + 1;
+        if (colonne == largeur - 1) colonnes[nombre_colonnes++] = 0;
+        if (colonne == 0) colonnes[nombre_colonnes++] = largeur + 1;
+    }
+    for (int i = 0; i < nombre_lignes; i++) {
+        for (int j = 0; j < nombre_colonnes; j++) {
+            automate->parents_potentiels[lignes[i] * largeur_halo + colonnes[j]] = valeur;
+        }
+    }
+}
+
+/**
+ * Leaves the dense storage: lists the living cells and clears the arrays the
+ * sparse generations fill and empty through the lists. Returns 0 (and stays
+ * dense) if the grid holds more than POPULATION_MAX_CLAIRSEMEE cells, e.g.
+ * after ecrire_cellule
+ */
+static int entrer_mode_clairseme(AutomateCellulaire *automate) {
+    int largeur = automate->largeur_grille, hauteur = automate->hauteur_grille;
+    int taille_totale = largeur * hauteur;
+    uint32_t population_max = POPULATION_MAX_CLAIRSEMEE(largeur, hauteur);
+    const uint8_t *vivante = automate->etat_actuel.vivante;
+    uint32_t nombre = 0;
+    
+    for (int debut = 0; debut < taille_totale; debut += 4) {
+        int fin = (debut + 4 <= taille_totale) ? debut + 4 : taille_totale;
+        if (fin - debut == 4 && *(const quatre_octets_u*)&vivante[debut] == 0) continue;
+        for (int position = debut; position < fin; position++) {
+            if (!vivante[position]) continue;
+            if (nombre == population_max) return 0;
+            automate->cellules_vivantes[nombre++] = (uint32_t)position;
+        }
+    }
+    
+    effacer_octets(automate->densite_voisinage, taille_totale);
+    effacer_octets(automate->parents_potentiels, (int)TAILLE_GRILLE_HALO(largeur, hauteur));
+    effacer_octets(automate->etat_suivant.vivante, taille_totale);
+    automate->nombre_cellules_vivantes = nombre;
+    automate->mode_clairseme = 1;
+    return 1;
+}
+
+/**
+ * Sparse counterpart of construire_lignes_plan + compter_voisins for the rows
+ * [premiere_ligne, fin_lignes): each living cell of these rows or next to them adds
+ * itself to the 3x3 counts of its neighbors in these rows (with the same wrap-around
+ * or edge rules), and the cells of these rows mark themselves as parents. A site
+ * whose count leaves 0 becomes a candidate, listed in the part's own rows of
+ * cellules_mobiles; returns the number of candidates
+ */
+static uint32_t compter_voisins_clairseme(AutomateCellulaire *automate, int premiere_ligne, int fin_lignes) {
+    int largeur = automate->largeur_grille, hauteur = automate->hauteur_grille;
+    const uint32_t *vivantes = automate->cellules_vivantes;
+    uint32_t *candidates = automate->cellules_mobiles + premiere_ligne * largeur;
+    uint8_t *densites = automate->densite_voisinage;
+    int torique = (automate->bord == BORD_TORIQUE);
+    uint32_t nombre_candidates = 0;
+    
+    for (uint32_t i = 0; i < automate->nombre_cellules_vivantes; i++) {
+        int position = (int)vivantes[i];
+        int ligne = position / largeur, colonne = position % largeur;
+        if (!ligne_touche_lignes(automate, ligne, premiere_ligne, fin_lignes)) continue;
+        
+        if (ligne >= premiere_ligne && ligne < fin_lignes) {
+            uint32_t fertilite = fertilite_par_age[automate->etat_actuel.age[position]];
+            if (fertilite >= SEUIL_PARENT_FERTILE) {
+                ecrire_parent_halo(automate, ligne, colonne, 1);
+                preparer_cache_parent(automate, (uint32_t)position, fertilite, &automate->cache_parents[position]);
+            }
+        }
+        
+        for (int decalage_ligne = -1; decalage_ligne <= 1; decalage_ligne++) {
+            int ligne_voisine = ligne + decalage_ligne;
+            if (ligne_voisine < 0 || ligne_voisine >= hauteur) {
+                if (!torique) continue;
+                ligne_voisine = (ligne_voisine < 0) ? hauteur - 1 : 0;
+            }
+            if (ligne_voisine < premiere_ligne || ligne_voisine >= fin_lignes) continue;
+            for (int decalage_colonne = -1; decalage_colonne <= 1; decalage_colonne++) {
+                int colonne_voisine = colonne + decalage_colonne;
+                if (colonne_voisine < 0 || colonne_voisine >= largeur) {
+                    if (!torique) continue;
+                    colonne_voisine = (colonne_voisine < 0) ? largeur - 1 : 0;
                 }
+                int voisine = ligne_voisine * largeur + colonne_voisine;
+                if (densites[voisine]++ == 0) candidates[nombre_candidates++] = (uint32_t)voisine;
             }
         }
     }
+    return nombre_candidates;
+}
+
+// Tuiles peuplées des rangées [premiere_rangee, fin_rangees) depuis la liste des vivantes
+static void marquer_tuiles_peuplees_clairseme(AutomateCellulaire *automate, uint32_t premiere_rangee,
+                                              uint32_t fin_rangees) {
+    int largeur = automate->largeur_grille, hauteur = automate->hauteur_grille;
+    uint32_t tuiles_par_ligne = MOTS_PAR_LIGNE(largeur);
+    int fin_lignes = ((int)(fin_rangees * COTE_TUILE) < hauteur) ? (int)(fin_rangees * COTE_TUILE) : hauteur;
+    uint32_t debut = premiere_rangee * COTE_TUILE * (uint32_t)largeur, fin = (uint32_t)(fin_lignes * largeur);
+    
+    effacer_octets(&automate->tuiles_peuplees[premiere_rangee * tuiles_par_ligne],
+                   (int)((fin_rangees - premiere_rangee) * tuiles_par_ligne));
+    for (uint32_t i = 0; i < automate->nombre_cellules_vivantes; i++) {
+        uint32_t position = automate->cellules_vivantes[i];
+        if (position >= debut && position < fin) automate->tuiles_peuplees[tuile_de_position(automate, (int)position)] = 1;
+    }
+}
+
+/**
+ * Steps 2 to 4 of a sparse generation (see calculer_generation_suivante) for
+ * the rows [premiere_ligne, fin_lignes): environment of their tiles, then update
+ * and nutrient resolve of their "nombre_candidates" candidates only (listed by
+ * compter_voisins_clairseme). Returns the number of living cells written
+ */
+static uint32_t calculer_lignes_clairsemees(AutomateCellulaire *automate, int premiere_ligne, int fin_lignes,
+                                            uint32_t nombre_candidates, int nutriments_max, uint32_t cle) {
+    int largeur = automate->largeur_grille;
+    const uint32_t *candidates = automate->cellules_mobiles + premiere_ligne * largeur;
+    uint32_t vivantes = 0;
+    
+    for (uint32_t rangee = (uint32_t)premiere_ligne / COTE_TUILE; (int)(rangee * COTE_TUILE) < fin_lignes; rangee++) {
+        int debut_bande = ((int)(rangee * COTE_TUILE) > premiere_ligne) ? (int)(rangee * COTE_TUILE) : premiere_ligne;
+        int fin_bande = ((int)((rangee + 1) * COTE_TUILE) < fin_lignes) ? (int)((rangee + 1) * COTE_TUILE) : fin_lignes;
+        mettre_a_jour_lignes_environnement(automate, rangee, debut_bande, fin_bande, nutriments_max);
+    }
     
-    // 3) Échanger les grilles de cellules
-    CelluleEvolutive *grille_temporaire = automate->grille_cellules_actuelles;
-    automate->grille_cellules_actuelles = automate->grille_cellules_suivantes;
-    automate->grille_cellules_suivantes = grille_temporaire;
+    for (uint32_t i = 0; i < nombre_candidates; i++) {
+        uint32_t position = candidates[i];
+        calculer_cellule(automate, (int)position / largeur, (int)position % largeur, cle);
+        automate->environnement.nutriments[position] -= automate->demande_nutriments[position];
+        vivantes += automate->etat_suivant.vivante[position];
+    }
+    return vivantes;
+}
+
+/**
+ * End of a sparse generation: the candidates of every part still alive become
+ * the new list, and the arrays filled on the way are cleared again through the
+ * lists. Leaves the sparse mode when the new population no longer fits the list
+ */
+static void conclure_etat_clairseme(AutomateCellulaire *automate, const BilanPartGeneration bilans[],
+                                    uint32_t nombre_parts) {
+    int largeur = automate->largeur_grille;
+    uint32_t population_max = POPULATION_MAX_CLAIRSEMEE(largeur, automate->hauteur_grille);
     
-    // 4) PHASE DE MOUVEMENT POLARISÉ (RÉACTIVÉ AVEC PRUDENCE)
-    // Mouvement très occasionnel pour introduire de la dynamique sans déstabiliser
-    if (automate->generation_actuelle % 10 == 0) {  // Seulement toutes les 10 générations
-        for (int ligne = 0; ligne < hauteur; ligne++) {
-            for (int colonne = 0; colonne < largeur; colonne++) {
-                int position_cellule = ligne * largeur + colonne;
-                CelluleEvolutive* cellule = &automate->grille_cellules_actuelles[position_cellule];
-                
-                if (cellule->vivante && doit_se_deplacer(cellule, 0)) {
-                    // Calculer position cible selon polarisation
-                    int delta_x, delta_y;
-                    obtenir_coordonnees_direction(cellule->polarisation, &delta_x, &delta_y);
-                    
-                    int nouvelle_ligne = (ligne + delta_y + hauteur) % hauteur;
-                    int nouvelle_colonne = (colonne + delta_x + largeur) % largeur;
-                    int nouvelle_position = nouvelle_ligne * largeur + nouvelle_colonne;
-                    
-                    // Déplacer seulement si la case cible est libre
-                    if (!automate->grille_cellules_actuelles[nouvelle_position].vivante) {
-                        // Effectuer le déplacement avec probabilité réduite
-                        generateur = generateur * 1103515245u + 12345u;
-                        if ((generateur % 100) < 30) {  // Seulement 30% de chance de bouger
-                            automate->grille_cellules_actuelles[nouvelle_position] = *cellule;
-                            
-                            // Vider l'ancienne position
-                            cellule->vivante = 0;
-                            cellule->age = 0;
-                            cellule->sante = 0;
-                            cellule->race = RACE_EXPLORATRICE;
-                            cellule->polarisation = DIRECTION_NORD;
-                            cellule->force_polarisation = 0;
-                            cellule->compteur_mouvement = 0;
-                        }
-                    }
+    // L'état actuel deviendra le tampon arrière : ses vivantes et leurs marques de parent s'effacent
+    for (uint32_t i = 0; i < automate->nombre_cellules_vivantes; i++) {
+        int position = (int)automate->cellules_vivantes[i];
+        automate->etat_actuel.vivante[position] = 0;
+        ecrire_parent_halo(automate, position / largeur, position % largeur, 0);
+    }
+    
+    // Remise à zéro des comptes, et nouvelle liste
+    uint32_t nombre_vivantes = 0;
+    for (uint32_t part = 0; part < nombre_parts; part++) {
+        int premiere_ligne, fin_lignes;
+        lignes_part(automate, part, nombre_parts, &premiere_ligne, &fin_lignes);
+        const uint32_t *candidates = automate->cellules_mobiles + premiere_ligne * largeur;
+        for (uint32_t i = 0; i < bilans[part].nombre_candidates; i++) {
+            uint32_t position = candidates[i];
+            automate->densite_voisinage[position] = 0;
+            if (!automate->etat_suivant.vivante[position]) continue;
+            if (nombre_vivantes < population_max) automate->cellules_vivantes[nombre_vivantes] = position;
+            nombre_vivantes++;
+        }
+    }
+    
+    if (nombre_vivantes > population_max) {
+        automate->mode_clairseme = 0;  // La génération suivante balaiera la grille
+        return;
+    }
+    automate->nombre_cellules_vivantes = nombre_vivantes;
+}
+
+/**
+ * Movement phase of a sparse generation, once every part has moved its cells: the
+ * sources that moved leave the list and the claimed targets (listed by each part)
+ * join it; the movement flags are cleared on the way
+ */
+static void suivre_mouvements_clairsemes(AutomateCellulaire *automate, const BilanPartGeneration bilans[],
+                                         uint32_t nombre_parts) {
+    uint32_t *vivantes = automate->cellules_vivantes;
+    uint32_t nombre = 0;
+    
+    for (uint32_t i = 0; i < automate->nombre_cellules_vivantes; i++) {
+        automate->densite_voisinage[vivantes[i]] = 0;
+        if (automate->etat_actuel.vivante[vivantes[i]]) vivantes[nombre++] = vivantes[i];
+    }
+    for (uint32_t part = 0; part < nombre_parts; part++) {
+        int premiere_ligne, fin_lignes;
+        lignes_part(automate, part, nombre_parts, &premiere_ligne, &fin_lignes);
+        const uint32_t *cibles = automate->cellules_mobiles + premiere_ligne * automate->largeur_grille;
+        for (uint32_t i = 0; i < bilans[part].nombre_cibles; i++) vivantes[nombre++] = cibles[i];
+    }
+    automate->nombre_cellules_vivantes = nombre;
+}
+
+// =============================
+// GÉNÉRATION SUIVANTE
+// =============================
+
+// Blocs de lignes de la génération dense : les tableaux par site touchés par
+// l'environnement et la mise à jour (environ 36 octets par site) d'un bloc doivent
+// tenir dans la moitié d'un cache L2 de 256 Kio, le reste allant au plan et aux
+// lignes voisines
+#define OCTETS_PAR_SITE_GENERATION 36u
+#define OCTETS_BLOC_GENERATION (128u * 1024u)
+
+/**
+ * Cells of the rows [premiere_ligne, fin_lignes) of the band "rangee": the rows
+ * are sorted by runs of tiles of the same activity, so that access stays
+ * sequential (see trier_segment), then each list goes through its own branch,
+ * without the alive / dead misprediction of a mixed scan. Each cell only writes
+ * its own site, so the order of the lists does not change the result
+ * The lists live in the block's own rows of cellules_mobiles (free until the
+ * movement phase), so that blocks of different bands never share them:
+ * survivors from the block's first site, birth candidates backwards from its end
+ * Returns the number of living cells written
+ */
+static uint32_t calculer_lignes(AutomateCellulaire *automate, uint32_t rangee, int premiere_ligne, int fin_lignes,
+                                uint32_t cle) {
+    int largeur = automate->largeur_grille;
+    uint32_t tuiles_par_ligne = MOTS_PAR_LIGNE(largeur);
+    const uint8_t *actives = &automate->tuiles_actives[rangee * tuiles_par_ligne];
+    const uint8_t *vivante_suivante = automate->etat_suivant.vivante;
+    uint32_t vivantes = 0;
+    ListesMiseAJour listes = {
+        .survivantes = automate->cellules_mobiles + premiere_ligne * largeur,
+        .naissances = automate->cellules_mobiles + fin_lignes * largeur
+    };
+    
+    for (int ligne = premiere_ligne; ligne < fin_lignes; ligne++) {
+        uint32_t tuile = 0;
+        while (tuile < tuiles_par_ligne) {
+            uint32_t fin_plage = tuile + 1;
+            while (fin_plage < tuiles_par_ligne && actives[fin_plage] == actives[tuile]) fin_plage++;
+            int debut = (int)(tuile * COTE_TUILE);
+            int fin = (fin_plage * COTE_TUILE < (uint32_t)largeur) ? (int)(fin_plage * COTE_TUILE) : largeur;
+            if (actives[tuile]) trier_segment(automate, ligne, debut, fin, &listes);
+            else vider_segment(automate, ligne, debut, fin);
+            tuile = fin_plage;
+        }
+    }
+    
+    // ===== CELLULES VIVANTES : SURVIE ? =====
+    for (uint32_t i = 0; i < listes.nombre_survivantes; i++) {
+        int position = (int)listes.survivantes[i];
+        traiter_survie(automate, position, automate->densite_voisinage[position] - 1, cle);
+        vivantes += vivante_suivante[position];
+    }
+    
+    // ===== CELLULES MORTES : NAISSANCE ? ===== (dans l'ordre de balayage)
+    for (uint32_t i = 1; i <= listes.nombre_naissances; i++) {
+        int position = (int)listes.naissances[-(int)i];
+        int ligne = position / largeur;
+        traiter_naissance(automate, ligne, position - ligne * largeur, automate->densite_voisinage[position], cle);
+        vivantes += vivante_suivante[position];
+    }
+    return vivantes;
+}
+
+// Lignes d'un bloc de la génération dense : leurs tableaux par site tiennent dans OCTETS_BLOC_GENERATION
+static int lignes_bloc_generation(const AutomateCellulaire *automate) {
+    int lignes_bloc = (int)(OCTETS_BLOC_GENERATION / ((uint32_t)automate->largeur_grille * OCTETS_PAR_SITE_GENERATION));
+    return (lignes_bloc < 1) ? 1 : lignes_bloc;
+}
+
+/**
+ * Steps 2 to 4 of a dense generation on the rows [premiere_ligne, fin_lignes)
+ * (see calculer_generation_suivante); inactive tiles are only cleared
+ * Once the occupation plane is built and the deferred tiles are prepared, a
+ * site's neighbor count, environment, new state and nutrient resolve only depend
+ * on its own site and on that plane: the steps are fused per band of tiles
+ * (counting, then the environment, cell update and resolve of a block of
+ * "lignes_bloc" rows at a time), so that the rows of the per-site arrays are
+ * reused while still in cache instead of sweeping the grid four times. Rows only
+ * write their own sites, so any split of the grid in rows can run in any order,
+ * or at the same time (see calculer_etape_generation)
+ * Returns the number of living cells written
+ */
+static uint32_t calculer_lignes_denses(AutomateCellulaire *automate, int premiere_ligne, int fin_lignes,
+                                       int nutriments_max, int lignes_bloc, uint32_t cle) {
+    int largeur = automate->largeur_grille;
+    uint32_t vivantes = 0;
+    
+    for (uint32_t rangee = (uint32_t)premiere_ligne / COTE_TUILE; (int)(rangee * COTE_TUILE) < fin_lignes; rangee++) {
+        int debut_bande = ((int)(rangee * COTE_TUILE) > premiere_ligne) ? (int)(rangee * COTE_TUILE) : premiere_ligne;
+        int fin_bande = ((int)((rangee + 1) * COTE_TUILE) < fin_lignes) ? (int)((rangee + 1) * COTE_TUILE) : fin_lignes;
+        
+        // Comptage des voisins des lignes de la bande par blocs de 32 cellules
+        compter_voisins_lignes(automate, rangee, debut_bande, fin_bande);
+        
+        for (int ligne = debut_bande; ligne < fin_bande; ligne += lignes_bloc) {
+            int fin_bloc = (ligne + lignes_bloc < fin_bande) ? ligne + lignes_bloc : fin_bande;
+            
+            // 2) Mettre à jour l'environnement du bloc
+            mettre_a_jour_lignes_environnement(automate, rangee, ligne, fin_bloc, nutriments_max);
+            
+            // 3) Calculer le nouvel état de ses cellules (l'environnement n'est que lu,
+            //    chaque cellule inscrit sa demande de nutriments)
+            vivantes += calculer_lignes(automate, rangee, ligne, fin_bloc, cle);
+            
+            // 4) Prélever les nutriments demandés
+            resoudre_demande_nutriments(automate, ligne * largeur, fin_bloc * largeur);
+        }
+    }
+    return vivantes;
+}
+
+// Étapes d'une génération partagée du moteur évolutif, dans l'ordre, chacune sur les
+// lignes d'une part ou sur les rangées de tuiles qui commencent dans ses lignes
+typedef enum {
+    ETAPE_PLAN = 0,         // Plan d'occupation et parents (comptes et candidates d'une génération clairsemée)
+    ETAPE_TUILES,           // Lignes de halo, tuiles peuplées
+    ETAPE_ENVIRONNEMENT,    // Tuiles actives, tuiles différées avancées ou rendues à leurs tableaux
+    ETAPE_LIGNES,           // Environnement, nouvel état et nutriments des lignes
+    ETAPE_CONCLUSION,       // Tuiles inactives devenues uniformes différées
+    ETAPE_ECHANGE,          // Générations de mouvement : liste clairsemée et échange des états (part 0 seule)
+    ETAPE_INTENTIONS,       // Phase de mouvement : sources qui veulent bouger
+    ETAPE_RESERVATIONS,     // Cibles réservées par la plus petite source
+    ETAPE_DEPLACEMENTS      // Déplacements vers les cibles réservées
+} EtapeGeneration;
+
+// Le mouvement polarisé n'a lieu que toutes les 10 générations
+static inline int generation_de_mouvement(const AutomateCellulaire *automate) {
+    return automate->generation_actuelle % 10 == 0;
+}
+
+/**
+ * Stage "etape" of the current generation (see EtapeGeneration) on the rows
+ * [premiere_ligne, fin_lignes) and the bands of tiles that start in them; every
+ * stage only writes the sites or tiles of its rows (ETAPE_ECHANGE excepted, see
+ * echanger_etats), so the rows of a stage can be split in parts that run in any
+ * order or at the same time, once the previous stage is done everywhere
+ */
+static void executer_etape(AutomateCellulaire *automate, EtapeGeneration etape, int premiere_ligne, int fin_lignes,
+                           BilanPartGeneration *bilan) {
+    uint32_t premiere_rangee = ((uint32_t)premiere_ligne + COTE_TUILE - 1) / COTE_TUILE;
+    uint32_t fin_rangees = ((uint32_t)fin_lignes + COTE_TUILE - 1) / COTE_TUILE;
+    uint32_t tuiles_par_ligne = MOTS_PAR_LIGNE(automate->largeur_grille);
+    int clairsemee = automate->generation_clairsemee;
+    
+    switch (etape) {
+        case ETAPE_PLAN:
+            bilan->population = 0;
+            bilan->tuiles_calculees = 0;
+            bilan->tuiles_environnement = 0;
+            bilan->nombre_candidates = 0;
+            bilan->nombre_cibles = 0;
+            if (clairsemee) bilan->nombre_candidates = compter_voisins_clairseme(automate, premiere_ligne, fin_lignes);
+            else construire_lignes_plan(automate, premiere_ligne, fin_lignes);
+            break;
+            
+        case ETAPE_TUILES:
+            if (clairsemee) {
+                marquer_tuiles_peuplees_clairseme(automate, premiere_rangee, fin_rangees);
+                break;
+            }
+            if (premiere_rangee == 0 && fin_rangees > 0) rafraichir_halos_occupation(automate);
+            marquer_tuiles_peuplees(automate, premiere_rangee, fin_rangees);
+            break;
+            
+        case ETAPE_ENVIRONNEMENT: {
+            int nutriments_max = calculer_nutriments_max(automate);
+            etendre_tuiles_actives(automate, premiere_rangee, fin_rangees);
+            for (uint32_t rangee = premiere_rangee; rangee < fin_rangees; rangee++) {
+                preparer_bande_environnement(automate, rangee, nutriments_max);
+                if (clairsemee) continue;
+                for (uint32_t tuile = 0; tuile < tuiles_par_ligne; tuile++) {
+                    bilan->tuiles_calculees += automate->tuiles_actives[rangee * tuiles_par_ligne + tuile];
                 }
             }
+            break;
+        }
+            
+        case ETAPE_LIGNES: {
+            uint32_t cle = cle_generation(automate);  // Tirages indexés par (graine, génération, cellule, emplacement)
+            int nutriments_max = calculer_nutriments_max(automate);
+            if (clairsemee) {
+                bilan->population = calculer_lignes_clairsemees(automate, premiere_ligne, fin_lignes,
+                                                                bilan->nombre_candidates, nutriments_max, cle);
+            } else {
+                bilan->population = calculer_lignes_denses(automate, premiere_ligne, fin_lignes, nutriments_max,
+                                                           lignes_bloc_generation(automate), cle);
+            }
+            break;
+        }
+            
+        case ETAPE_CONCLUSION:
+            for (uint32_t rangee = premiere_rangee; rangee < fin_rangees; rangee++) {
+                bilan->tuiles_environnement += conclure_bande_environnement(automate, rangee);
+            }
+            break;
+            
+        case ETAPE_INTENTIONS:
+            lister_intentions(automate, premiere_ligne, fin_lignes, cle_generation(automate));
+            break;
+            
+        case ETAPE_RESERVATIONS:
+            bilan->nombre_cibles = reserver_cibles(automate, premiere_ligne, fin_lignes);
+            break;
+            
+        case ETAPE_DEPLACEMENTS:
+            deplacer_vers_cibles(automate, premiere_ligne, bilan->nombre_cibles);
+            break;
+            
+        case ETAPE_ECHANGE:
+            break;
+    }
+}
+
+/**
+ * Reports of the parts, new sparse list, then the swap of the hot state (the
+ * cold traits are already up to date in place): in the middle of a movement
+ * generation (ETAPE_ECHANGE, on one part), at the end of the others
+ */
+static void echanger_etats(AutomateCellulaire *automate, const BilanPartGeneration bilans[], uint32_t nombre_parts) {
+    automate->population_totale = 0;
+    automate->tuiles_calculees = 0;
+    automate->tuiles_environnement = 0;
+    for (uint32_t part = 0; part < nombre_parts; part++) {
+        automate->population_totale += bilans[part].population;
+        automate->tuiles_calculees += bilans[part].tuiles_calculees;
+        automate->tuiles_environnement += bilans[part].tuiles_environnement;
+    }
+    if (automate->generation_clairsemee) conclure_etat_clairseme(automate, bilans, nombre_parts);
+    
+    EtatCellules etat_temporaire = automate->etat_actuel;
+    automate->etat_actuel = automate->etat_suivant;
+    automate->etat_suivant = etat_temporaire;
+}
+
+/**
+ * Calculates next generation with advanced biological realism
+ * 
+ * This function implements a comprehensive evolutionary simulation including:
+ * - Realistic predator-prey dynamics with spatial gradients
+ * - Epidemic disease spread and resistance evolution
+ * - Environmental stress adaptation and mutation
+ * - Seasonal resource cycles and territorial competition
+ * - Multi-trait inheritance with stress-adaptive mutation rates
+ * 
+ * Runs a shared generation on the calling processor, with the whole grid as its
+ * single part: debuter_generation_partagee (storage choice, cyclic scalars), each
+ * stage of calculer_etape_generation in turn (occupation plane or sparse neighbor
+ * counts, tiles, environment, new state and nutrients of every row, deferred
+ * tiles, movement phase), then terminer_generation_partagee (buffer swap,
+ * generation counter)
+ * 
+ * @param automate Pointer to the cellular automaton structure
+ * @note Gives the same result as the same generation shared between several processors
+ */
+void calculer_generation_suivante(AutomateCellulaire *automate) {
+    // Safety checks
+    if (!automate || !memoire_attachee(automate)) return;
+    
+    BilanPartGeneration bilan;
+    uint32_t nombre_etapes = debuter_generation_partagee(automate);
+    for (uint32_t etape = 0; etape < nombre_etapes; etape++) calculer_etape_generation(automate, etape, 0, 1, &bilan);
+    terminer_generation_partagee(automate, &bilan, 1);
+}
+
+uint32_t debuter_generation_partagee(AutomateCellulaire *automate) {
+    if (!automate || !memoire_attachee(automate)) return 0;
+    
+    if (automate->moteur == MOTEUR_BITBOARD) {
+        // Le plan a pu être modifié par ecrire_cellule depuis la dernière génération
+        rafraichir_halo_plan(automate, automate->plan_occupation);
+        return 1;
+    }
+    
+    int largeur = automate->largeur_grille, hauteur = automate->hauteur_grille;
+    
+    // 0) Stockage : liste des vivantes sous le seuil (avec hystérésis), grille entière au-dessus
+    uint32_t population_max = POPULATION_MAX_CLAIRSEMEE(largeur, hauteur);
+    if (automate->stockage == STOCKAGE_DENSE || automate->population_totale > population_max) {
+        automate->mode_clairseme = 0;
+    } else if (!automate->mode_clairseme && automate->population_totale <= population_max / 2) {
+        entrer_mode_clairseme(automate);
+    }
+    automate->generation_clairsemee = automate->mode_clairseme;
+    
+    // 1) Scalaires cycliques de la génération ; peu de cellules vivantes : comptes de
+    //    voisins autour d'elles seulement (ETAPE_PLAN), qui désignent les candidates
+    preparer_cycles_generation(automate);
+    return generation_de_mouvement(automate) ? ETAPE_DEPLACEMENTS + 1 : ETAPE_CONCLUSION + 1;
+}
+
+void calculer_etape_generation(AutomateCellulaire *automate, uint32_t etape, uint32_t part, uint32_t nombre_parts,
+                               BilanPartGeneration bilans[]) {
+    // L'échange réécrit les états de l'automate : les autres parts ne doivent pas le lire
+    if (etape == ETAPE_ECHANGE && part != 0) return;
+    if (!automate || !memoire_attachee(automate) || part >= nombre_parts) return;
+    
+    int premiere_ligne, fin_lignes;
+    lignes_part(automate, part, nombre_parts, &premiere_ligne, &fin_lignes);
+    
+    if (automate->moteur == MOTEUR_BITBOARD) {
+        // Par bandes de LIGNES_BANDE_TEMPORELLE lignes pour que les colonnes de mots restent en cache
+        uint32_t mots_par_ligne = MOTS_PAR_LIGNE(automate->largeur_grille);
+        ReglesBitboard regles;
+        preparer_regles_bitboard(automate, &regles);
+        
+        bilans[part].population = 0;
+        for (int ligne = premiere_ligne; ligne < fin_lignes; ligne += LIGNES_BANDE_TEMPORELLE) {
+            int lignes = (ligne + LIGNES_BANDE_TEMPORELLE < fin_lignes) ? LIGNES_BANDE_TEMPORELLE : fin_lignes - ligne;
+            calculer_lignes_bitboard(automate, &regles, &automate->plan_occupation[ligne * mots_par_ligne],
+                                     &automate->plan_suivant[ligne * mots_par_ligne], lignes, &bilans[part].population);
         }
+        return;
+    }
+    
+    if (etape == ETAPE_ECHANGE) {
+        echanger_etats(automate, bilans, nombre_parts);
+        return;
+    }
+    executer_etape(automate, (EtapeGeneration)etape, premiere_ligne, fin_lignes, &bilans[part]);
+}
+
+void terminer_generation_partagee(AutomateCellulaire *automate, const BilanPartGeneration bilans[],
+                                  uint32_t nombre_parts) {
+    if (!automate || !memoire_attachee(automate)) return;
+    
+    if (automate->moteur == MOTEUR_BITBOARD) {
+        uint32_t population = 0;
+        for (uint32_t part = 0; part < nombre_parts; part++) population += bilans[part].population;
+        automate->population_totale = population;
+        
+        uint32_t *plan = automate->plan_occupation;
+        automate->plan_occupation = automate->plan_suivant;
+        automate->plan_suivant = plan;
+        automate->generation_actuelle++;
+        return;
     }
     
-    // 5) Incrémenter le compteur de génération
+    // Échange des états, déjà fait par ETAPE_ECHANGE avant la phase de mouvement ;
+    // la liste clairsemée suit alors les cellules qui ont bougé
+    if (!generation_de_mouvement(automate)) echanger_etats(automate, bilans, nombre_parts);
+    else if (automate->mode_clairseme) suivre_mouvements_clairsemes(automate, bilans, nombre_parts);
+    
+    // Incrémenter le compteur de génération
     automate->generation_actuelle++;
 }
 
+// =============================
+// BLOCAGE TEMPOREL DU MOTEUR ÉVOLUTIF
+// =============================
+
+// Tableaux par site qu'une grille de travail reçoit et rend : état chaud actuel,
+// traits froids et environnement
+#define NOMBRE_TABLEAUX_BANDE 23
+
+static void lister_tableaux_bande(const AutomateCellulaire *automate, uint8_t *tableaux[NOMBRE_TABLEAUX_BANDE]) {
+    const EtatCellules *etat = &automate->etat_actuel;
+    const TraitsCellules *traits = &automate->traits;
+    const EnvironnementCellules *env = &automate->environnement;
+    uint8_t *liste[NOMBRE_TABLEAUX_BANDE] = {
+        etat->vivante, etat->age, etat->sante, etat->compteur_mouvement,
+        traits->genotype_survie, traits->genotype_naissance, traits->race, traits->polarisation,
+        traits->force_polarisation, traits->fitness_reproductif, traits->efficacite_energetique,
+        traits->espece_id, traits->resistance_maladie, traits->camouflage_predation,
+        traits->territorialite, traits->adaptabilite_stress, traits->generation_naissance,
+        env->nutriments, env->temperature, env->pression_predation, env->pathogenes_present,
+        env->toxicite_locale, env->competition_territoriale
+    };
+    for (int i = 0; i < NOMBRE_TABLEAUX_BANDE; i++) tableaux[i] = liste[i];
+}
+
+// Copie "nombre_lignes" lignes consécutives de tous ces tableaux d'une grille à l'autre (même largeur)
+static void copier_lignes_bande(AutomateCellulaire *destination, int ligne_destination,
+                                const AutomateCellulaire *source, int ligne_source, int nombre_lignes) {
+    int largeur = source->largeur_grille;
+    uint8_t *tableaux_destination[NOMBRE_TABLEAUX_BANDE], *tableaux_source[NOMBRE_TABLEAUX_BANDE];
+    lister_tableaux_bande(destination, tableaux_destination);
+    lister_tableaux_bande(source, tableaux_source);
+    
+    for (int i = 0; i < NOMBRE_TABLEAUX_BANDE; i++) {
+        copier_octets(&tableaux_destination[i][ligne_destination * largeur],
+                      &tableaux_source[i][ligne_source * largeur], nombre_lignes * largeur);
+    }
+}
+
+// Bande "bande" de LIGNES_BANDE_EVOLUTIVE lignes : première ligne, nombre de lignes et lignes
+// de halo au-dessus et au-dessous (sur un tore, celles du bord opposé ; aucune au-delà d'un bord fixe)
+typedef struct {
+    int premiere_ligne;
+    int lignes;
+    int halo_haut;
+    int halo_bas;
+} BandeEvolutive;
+
+static BandeEvolutive decouper_bande_evolutive(const AutomateCellulaire *automate, int bande, int halo) {
+    int hauteur = automate->hauteur_grille;
+    BandeEvolutive decoupe;
+    decoupe.premiere_ligne = bande * LIGNES_BANDE_EVOLUTIVE;
+    decoupe.lignes = (decoupe.premiere_ligne + LIGNES_BANDE_EVOLUTIVE < hauteur) ? LIGNES_BANDE_EVOLUTIVE
+                                                                                : hauteur - decoupe.premiere_ligne;
+    decoupe.halo_haut = halo;
+    decoupe.halo_bas = halo;
+    if (automate->bord == BORD_FIXE) {
+        int restantes = hauteur - decoupe.premiere_ligne - decoupe.lignes;
+        if (decoupe.halo_haut > decoupe.premiere_ligne) decoupe.halo_haut = decoupe.premiere_ligne;
+        if (decoupe.halo_bas > restantes) decoupe.halo_bas = restantes;
+    }
+    return decoupe;
+}
+
+/**
+ * Loads a band with its halo rows into the scratch grid carved from "zone": same
+ * rules, boundary, seed and generation as the grid, dense storage, its own rows
+ * of every per-site array and of the static fields, no deferred tile (the grid's
+ * environment is materialized first)
+ */
+static void charger_grille_travail(AutomateCellulaire *travail, uint8_t *zone, const AutomateCellulaire *automate,
+                                   const BandeEvolutive *decoupe) {
+    int largeur = automate->largeur_grille, hauteur = automate->hauteur_grille;
+    int lignes_travail = decoupe->halo_haut + decoupe->lignes + decoupe->halo_bas;
+    int ligne_origine = decoupe->premiere_ligne - decoupe->halo_haut;
+    if (ligne_origine < 0) ligne_origine += hauteur;
+    
+    *travail = *automate;
+    travail->hauteur_grille = lignes_travail;
+    travail->stockage = STOCKAGE_DENSE;
+    travail->grilles_travail = NULL;
+    travail->ligne_origine = ligne_origine;
+    travail->hauteur_origine = hauteur;
+    reserver_grille_evolutive(travail, zone);
+    effacer_octets(travail->tuiles_differees, (int)NOMBRE_TUILES(largeur, lignes_travail));
+    
+    // Une grille de travail n'est pas plus haute que la grille : au plus deux suites de
+    // lignes, la seconde après la jointure du tore
+    int avant_jointure = (ligne_origine + lignes_travail <= hauteur) ? lignes_travail : hauteur - ligne_origine;
+    copier_lignes_bande(travail, 0, automate, ligne_origine, avant_jointure);
+    copier_lignes_bande(travail, avant_jointure, automate, 0, lignes_travail - avant_jointure);
+    copier_octets((uint8_t*)travail->gradient_predation, (const uint8_t*)&automate->gradient_predation[ligne_origine * largeur],
+                  avant_jointure * largeur * (int)sizeof(uint16_t));
+    copier_octets((uint8_t*)&travail->gradient_predation[avant_jointure * largeur], (const uint8_t*)automate->gradient_predation,
+                  (lignes_travail - avant_jointure) * largeur * (int)sizeof(uint16_t));
+    copier_octets((uint8_t*)travail->niche_ecologique, (const uint8_t*)&automate->niche_ecologique[ligne_origine * largeur],
+                  avant_jointure * largeur * (int)sizeof(uint16_t));
+    copier_octets((uint8_t*)&travail->niche_ecologique[avant_jointure * largeur], (const uint8_t*)automate->niche_ecologique,
+                  (lignes_travail - avant_jointure) * largeur * (int)sizeof(uint16_t));
+}
+
+/**
+ * Advances a loaded scratch grid "profondeur" generations. A generation only
+ * reads the rows next to the ones it writes and a movement phase moves a cell by
+ * one row after claims between movers two rows apart: the rows still exact
+ * shrink by one row at both ends per generation and by two more per movement
+ * phase. Only those are computed (the others are left stale), down to exactly
+ * the band's own rows after the last generation
+ */
+static void avancer_grille_travail(AutomateCellulaire *travail, const BandeEvolutive *decoupe, uint32_t profondeur,
+                                   int halo) {
+    for (uint32_t pas = 0; pas < profondeur; pas++) {
+        int mouvement = generation_de_mouvement(travail);
+        int debut = decoupe->halo_haut - (halo - 1), fin = decoupe->halo_haut + decoupe->lignes + (halo - 1);
+        if (debut < 0) debut = 0;
+        if (fin > travail->hauteur_grille) fin = travail->hauteur_grille;
+        
+        // Étapes sur toute la grille de travail, sauf le nouvel état des lignes hors de la marge
+        BilanPartGeneration bilan;
+        uint32_t nombre_etapes = debuter_generation_partagee(travail);
+        for (uint32_t etape = 0; etape < nombre_etapes; etape++) {
+            if (etape == ETAPE_ECHANGE) echanger_etats(travail, &bilan, 1);
+            else if (etape == ETAPE_LIGNES) executer_etape(travail, ETAPE_LIGNES, debut, fin, &bilan);
+            else executer_etape(travail, (EtapeGeneration)etape, 0, travail->hauteur_grille, &bilan);
+        }
+        terminer_generation_partagee(travail, &bilan, 1);
+        halo -= mouvement ? 3 : 1;
+    }
+}
+
+// Rend les lignes de la bande à la grille ; retourne leur nombre de cellules vivantes
+static uint32_t rendre_grille_travail(AutomateCellulaire *automate, AutomateCellulaire *travail,
+                                      const BandeEvolutive *decoupe) {
+    int largeur = automate->largeur_grille;
+    materialiser_environnement(travail);
+    copier_lignes_bande(automate, decoupe->premiere_ligne, travail, decoupe->halo_haut, decoupe->lignes);
+    
+    uint32_t vivantes = 0;
+    const uint8_t *vivante = &travail->etat_actuel.vivante[decoupe->halo_haut * largeur];
+    for (int position = 0; position < decoupe->lignes * largeur; position++) vivantes += vivante[position];
+    return vivantes;
+}
+
+/**
+ * Temporal blocking of MOTEUR_EVOLUTIF ("profondeur" generations at once,
+ * 2 <= profondeur <= PROFONDEUR_TEMPORELLE_MAX)
+ * Each band of LIGNES_BANDE_EVOLUTIVE rows is loaded with its halo rows into a
+ * scratch grid (see charger_grille_travail) and advanced there: draws, species
+ * zones and movement order use positions of the whole grid, so its band ends up
+ * as after as many generations of the whole grid. A band is written back once the
+ * next one is loaded, in turns between two scratch grids; the first one is kept
+ * in a third one until the last band, whose halo on a torus holds its rows, is
+ * loaded. The halo rows are computed again by every band they border, in exchange
+ * the per-site arrays go through memory once per "profondeur" generations
+ */
+static void calculer_generations_evolutives_par_bandes(AutomateCellulaire *automate, uint32_t profondeur) {
+    int hauteur = automate->hauteur_grille;
+    uint32_t taille_travail = TAILLE_GRILLE_EVOLUTIVE(automate->largeur_grille, LIGNES_GRILLE_TRAVAIL);
+    int nombre_bandes = (hauteur + LIGNES_BANDE_EVOLUTIVE - 1) / LIGNES_BANDE_EVOLUTIVE;
+    AutomateCellulaire travail[3];
+    BandeEvolutive decoupes[3];
+    uint32_t population = 0;
+    
+    // Une ligne de halo par génération, deux de plus par phase de mouvement
+    int halo = (int)profondeur;
+    for (uint32_t etape = 0; etape < profondeur; etape++) {
+        if ((automate->generation_actuelle + etape) % 10 == 0) halo += 2;
+    }
+    
+    materialiser_environnement(automate);
+    for (int bande = 0; bande < nombre_bandes; bande++) {
+        int grille = (bande == 0) ? 0 : 1 + (bande - 1) % 2;
+        decoupes[grille] = decouper_bande_evolutive(automate, bande, halo);
+        charger_grille_travail(&travail[grille], automate->grilles_travail + grille * taille_travail, automate,
+                               &decoupes[grille]);
+        if (bande >= 2) {
+            int precedente = 1 + bande % 2;
+            population += rendre_grille_travail(automate, &travail[precedente], &decoupes[precedente]);
+        }
+        avancer_grille_travail(&travail[grille], &decoupes[grille], profondeur, halo);
+    }
+    int derniere = 1 + (nombre_bandes - 2) % 2;
+    population += rendre_grille_travail(automate, &travail[derniere], &decoupes[derniere]);
+    population += rendre_grille_travail(automate, &travail[0], &decoupes[0]);
+    
+    // Grille rendue en entier : environnement sans tuile différée, stockage dense jusqu'à la
+    // prochaine génération (qui choisit à nouveau)
+    automate->population_totale = population;
+    automate->generation_actuelle += profondeur;
+    automate->mode_clairseme = 0;
+    automate->generation_clairsemee = 0;
+}
+
+void avancer_generations(AutomateCellulaire *automate, uint32_t nombre_generations, uint32_t profondeur) {
+    if (!automate || !memoire_attachee(automate)) return;
+    if (profondeur > PROFONDEUR_TEMPORELLE_MAX) profondeur = PROFONDEUR_TEMPORELLE_MAX;
+    
+    while (nombre_generations > 0) {
+        uint32_t pas = (profondeur < nombre_generations) ? profondeur : nombre_generations;
+        if (pas > 1 && automate->moteur == MOTEUR_BITBOARD) {
+            calculer_generations_bitboard_par_bandes(automate, pas);
+        } else if (pas > 1 && automate->moteur == MOTEUR_EVOLUTIF && automate->grilles_travail) {
+            calculer_generations_evolutives_par_bandes(automate, pas);
+        } else {
+            // Génération par génération : profondeur 1, ou grille sans grilles de travail
+            calculer_generation_suivante(automate);
+            pas = 1;
+        }
+        nombre_generations -= pas;
+    }
+}
+
+// =============================
+// PHASES INDIVIDUELLES (INSTRUMENTATION)
+// =============================
+
+void executer_phase_environnement(AutomateCellulaire *automate) {
+    if (!automate || !automate->environnement.nutriments) return;
+    preparer_cycles_generation(automate);
+    mettre_a_jour_environnement(automate);
+}
+
+void executer_phase_voisinage(AutomateCellulaire *automate) {
+    if (!automate || !automate->plan_occupation || !automate->densite_voisinage) return;
+    automate->mode_clairseme = 0;
+    preparer_cycles_generation(automate);
+    construire_plan_occupation(automate);
+    compter_voisins(automate);
+}
+
+void executer_phase_survie(AutomateCellulaire *automate) {
+    if (!automate || !automate->densite_voisinage) return;
+    automate->mode_clairseme = 0;
+    
+    materialiser_environnement(automate);  // Les branches lisent les tableaux en direct
+    int taille_totale = automate->largeur_grille * automate->hauteur_grille;
+    uint32_t cle = cle_generation(automate);
+    for (int position = 0; position < taille_totale; position++) {
+        if (!automate->etat_actuel.vivante[position]) continue;
+        int nombre_voisins_vivants = automate->densite_voisinage[position] - 1;
+        if (!transition_possible(automate, 1, nombre_voisins_vivants)) continue;
+        traiter_survie(automate, position, nombre_voisins_vivants, cle);
+        automate->environnement.nutriments[position] -= automate->demande_nutriments[position];
+        automate->population_totale += automate->etat_suivant.vivante[position];
+    }
+}
+
+void executer_phase_naissance(AutomateCellulaire *automate) {
+    if (!automate || !automate->densite_voisinage) return;
+    automate->mode_clairseme = 0;
+    
+    materialiser_environnement(automate);  // Les branches lisent les tableaux en direct
+    int largeur = automate->largeur_grille, hauteur = automate->hauteur_grille;
+    uint32_t cle = cle_generation(automate);
+    for (int ligne = 0; ligne < hauteur; ligne++) {
+        for (int colonne = 0; colonne < largeur; colonne++) {
+            int position = ligne * largeur + colonne;
+            if (automate->etat_actuel.vivante[position] ||
+                !transition_possible(automate, 0, automate->densite_voisinage[position])) continue;
+            traiter_naissance(automate, ligne, colonne, automate->densite_voisinage[position], cle);
+            automate->environnement.nutriments[position] -= automate->demande_nutriments[position];
+            automate->population_totale += automate->etat_suivant.vivante[position];
+        }
+    }
+}
+
+void executer_phase_mouvement(AutomateCellulaire *automate) {
+    if (!automate || !automate->etat_actuel.vivante) return;
+    automate->mode_clairseme = 0;
+    
+    BilanPartGeneration bilan;
+    for (uint32_t etape = ETAPE_INTENTIONS; etape <= ETAPE_DEPLACEMENTS; etape++) {
+        executer_etape(automate, (EtapeGeneration)etape, 0, automate->hauteur_grille, &bilan);
+    }
+}
+
+// =============================
+// EMPREINTE DE L'ÉTAT (FNV-1a 64 bits)
+// =============================
+
+#define EMPREINTE_BASE_FNV    0xCBF29CE484222325ull
+#define EMPREINTE_PREMIER_FNV 0x00000100000001B3ull
+
+static uint64_t empreinte_ajouter_octet(uint64_t empreinte, uint8_t octet) {
+    return (empreinte ^ octet) * EMPREINTE_PREMIER_FNV;
+}
+
+static uint64_t empreinte_ajouter_mot(uint64_t empreinte, uint32_t mot) {
+    for (int decalage = 0; decalage < 32; decalage += 8) {
+        empreinte = empreinte_ajouter_octet(empreinte, (uint8_t)(mot >> decalage));
+    }
+    return empreinte;
+}
+
+uint64_t empreinte_debut(uint32_t generation, uint32_t population) {
+    uint64_t empreinte = EMPREINTE_BASE_FNV;
+    empreinte = empreinte_ajouter_mot(empreinte, generation);
+    return empreinte_ajouter_mot(empreinte, population);
+}
+
+uint64_t empreinte_ajouter_cellule(uint64_t empreinte, const CelluleEvolutive *cellule,
+                                   const EnvironnementLocal *environnement) {
+    empreinte = empreinte_ajouter_octet(empreinte, cellule->vivante);
+    
+    // Les champs d'une cellule morte ne sont jamais relus : seul l'état compte
+    if (cellule->vivante) {
+        empreinte = empreinte_ajouter_octet(empreinte, cellule->age);
+        empreinte = empreinte_ajouter_octet(empreinte, cellule->genotype_survie);
+        empreinte = empreinte_ajouter_octet(empreinte, cellule->genotype_naissance);
+        empreinte = empreinte_ajouter_octet(empreinte, cellule->sante);
+        empreinte = empreinte_ajouter_octet(empreinte, cellule->race);
+        empreinte = empreinte_ajouter_octet(empreinte, cellule->polarisation);
+        empreinte = empreinte_ajouter_octet(empreinte, cellule->force_polarisation);
+        empreinte = empreinte_ajouter_octet(empreinte, cellule->compteur_mouvement);
+        empreinte = empreinte_ajouter_octet(empreinte, cellule->fitness_reproductif);
+        empreinte = empreinte_ajouter_octet(empreinte, cellule->efficacite_energetique);
+        empreinte = empreinte_ajouter_octet(empreinte, cellule->espece_id);
+        empreinte = empreinte_ajouter_octet(empreinte, cellule->resistance_maladie);
+        empreinte = empreinte_ajouter_octet(empreinte, cellule->camouflage_predation);
+        empreinte = empreinte_ajouter_octet(empreinte, cellule->territorialite);
+        empreinte = empreinte_ajouter_octet(empreinte, cellule->adaptabilite_stress);
+        empreinte = empreinte_ajouter_octet(empreinte, cellule->generation_naissance);
+    }
+    
+    empreinte = empreinte_ajouter_octet(empreinte, environnement->nutriments);
+    empreinte = empreinte_ajouter_octet(empreinte, environnement->temperature);
+    empreinte = empreinte_ajouter_octet(empreinte, environnement->pression_predation);
+    empreinte = empreinte_ajouter_octet(empreinte, environnement->pathogenes_present);
+    empreinte = empreinte_ajouter_octet(empreinte, environnement->toxicite_locale);
+    return empreinte_ajouter_octet(empreinte, environnement->competition_territoriale);
+}
+
+uint64_t calculer_empreinte_etat(const AutomateCellulaire *automate) {
+    if (!automate || !memoire_attachee(automate)) return 0;
+    
+    int taille_totale = automate->largeur_grille * automate->hauteur_grille;
+    uint64_t empreinte = empreinte_debut(automate->generation_actuelle, automate->population_totale);
+    
+    // Moteur bitboard : ni traits ni environnement, seul l'état de chaque cellule
+    if (automate->moteur == MOTEUR_BITBOARD) {
+        for (int ligne = 0; ligne < automate->hauteur_grille; ligne++) {
+            for (int colonne = 0; colonne < automate->largeur_grille; colonne++) {
+                empreinte = empreinte_ajouter_octet(empreinte, 
+                    (uint8_t)lire_bit_plan(automate, automate->plan_occupation, ligne, colonne));
+            }
+        }
+        return empreinte;
+    }
+    
+    for (int position = 0; position < taille_totale; position++) {
+        CelluleEvolutive cellule;
+        EnvironnementLocal environnement;
+        lire_cellule(automate, position, &cellule);
+        lire_environnement(automate, position, &environnement);
+        empreinte = empreinte_ajouter_cellule(empreinte, &cellule, &environnement);
+    }
+    return empreinte;
+}
+
 // -------------------------------------------------------------
 // affiche 'O' pour vivant, ' ' pour mort dans la mémoire VGA
 // -------------------------------------------------------------
@@ -1134,12 +3555,16 @@ void afficher_grille_sur_ecran(const AutomateCellulaire *automate, volatile uint
             int position_grille = ligne_grille * automate->largeur_grille + colonne_grille;
             int position_ecran = ligne * 80 + colonne;
             
-            CelluleEvolutive* cellule = &automate->grille_cellules_actuelles[position_grille];
-            
-            if (cellule->vivante) {
+            if (automate->moteur == MOTEUR_BITBOARD) {
+                // Plain rules: no race nor age to show
+                int vivante = lire_bit_plan(automate, automate->plan_occupation, ligne_grille, colonne_grille);
+                memoire_vga[2 * position_ecran] = vivante ? 'O' : ' ';
+                memoire_vga[2 * position_ecran + 1] = vivante ? CA_ATTR_ALIVE : 0x00;
+            } else if (automate->etat_actuel.vivante[position_grille]) {
                 // Display by race with color according to age
-                char caractere = obtenir_caractere_race(cellule->race, cellule->sante);
-                uint8_t couleur = obtenir_couleur_age(cellule->age);
+                char caractere = obtenir_caractere_race((RaceCellule)automate->traits.race[position_grille],
+                                                        automate->etat_actuel.sante[position_grille]);
+                uint8_t couleur = obtenir_couleur_age(automate->etat_actuel.age[position_grille]);
                 
                 memoire_vga[2 * position_ecran] = caractere;
                 memoire_vga[2 * position_ecran + 1] = couleur;
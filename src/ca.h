@@ -73,6 +73,28 @@
 // Simulation parameters
 #define VITESSE_SIMULATION 100000000  // Delay between generations (higher = slower)
 
+// Benchmark boot mode (kernel): no rendering nor delay, RDTSC report on COM1, then QEMU exit
+// Also selectable at boot with "bench" or "bench=N" on the GRUB command line
+#ifndef MODE_BENCHMARK
+#define MODE_BENCHMARK 0              // 1 = always boot into the benchmark
+#endif
+#define GENERATIONS_BENCHMARK 1000    // Generations measured when no count is given
+
+// Processors used by the kernel: the application processors found in the ACPI MADT (or
+// the MP table) are started at boot and each computes its rows of every stage of a
+// generation (see calculer_etape_generation); 1 keeps the kernel on the bootstrap processor
+#ifndef PROCESSEURS_MAX
+#define PROCESSEURS_MAX 8
+#endif
+
+// HashLife boot mode (kernel): plain B/S rules on an unbounded plane, seeded with the
+// initial grid, leaping 2^PAS_HASHLIFE generations between two frames
+#ifndef MODE_HASHLIFE
+#define MODE_HASHLIFE 0               // 1 = kernel runs the HashLife engine
+#endif
+#define PAS_HASHLIFE 6                // log2 of the generations per frame
+#define TAILLE_MEMOIRE_HASHLIFE_NOYAU (16u * 1024u * 1024u)  // Node arena of the kernel (bytes)
+
 // Cellular automaton rules (easy to change)
 #define REGLES_AUTOMATE "B36/S23"  // HighLife with replicators (prevents stagnation)
 // Other examples:
@@ -80,6 +102,19 @@
 // #define REGLES_AUTOMATE "B2/S23"     // Seeds (very chaotic)
 // #define REGLES_AUTOMATE "B34/S34"    // 34 Life (different structures)
 
+// Simulation engine used by the kernel (see MoteurAutomate)
+// Also selectable at build time: make KERNEL_DEFINES=-DMOTEUR_AUTOMATE=MOTEUR_BITBOARD
+#ifndef MOTEUR_AUTOMATE
+#define MOTEUR_AUTOMATE MOTEUR_EVOLUTIF
+// #define MOTEUR_AUTOMATE MOTEUR_BITBOARD  // Plain B/S rules only, no biology
+#endif
+
+// Grid boundary used by the kernel (see BordAutomate)
+// Also selectable at build time: make KERNEL_DEFINES=-DBORD_AUTOMATE=BORD_FIXE
+#ifndef BORD_AUTOMATE
+#define BORD_AUTOMATE BORD_TORIQUE
+#endif
+
 // Cell races with distinct properties
 typedef enum {
     RACE_EXPLORATRICE = 0,    // Tendency to disperse
@@ -102,6 +137,25 @@ typedef enum {
     NOMBRE_DIRECTIONS = 8
 } DirectionPolarisation;
 
+// Simulation engines selectable on AutomateCellulaire
+typedef enum {
+    MOTEUR_EVOLUTIF = 0,      // Full biology (environment, genotypes, races, movement)
+    MOTEUR_BITBOARD = 1       // Plain B/S rules on a packed bit grid, 32 cells per word
+} MoteurAutomate;
+
+// Grid boundary: what lies beyond the last row / column
+typedef enum {
+    BORD_TORIQUE = 0,         // Wraps around (default)
+    BORD_FIXE = 1             // Always-dead cells: no neighbor, no parent, no move out of the grid
+} BordAutomate;
+
+// Cell storage of MOTEUR_EVOLUTIF: dense arrays swept every generation, or a list of
+// the living cells (their traits stay in the dense arrays) while the grid is sparse
+typedef enum {
+    STOCKAGE_AUTOMATIQUE = 0, // Switches with the population (default), see POPULATION_MAX_CLAIRSEMEE
+    STOCKAGE_DENSE = 1        // Always sweeps the whole grid
+} StockageAutomate;
+
 // Available initialization types
 typedef enum {
     INIT_ALEATOIRE_UNIFORME,      // Uniform distribution
@@ -112,6 +166,8 @@ typedef enum {
 /**
  * Evolutionary Cell Structure - Advanced Biological Simulation
  * Contains all traits necessary for realistic evolution simulation
+ * Logical view of one cell: the automaton stores these fields as separate
+ * arrays (see EtatCellules / TraitsCellules), use lire_cellule / ecrire_cellule
  */
 typedef struct {
     uint8_t vivante;                    ///< Cell state: 0 = dead, 1 = alive
@@ -119,8 +175,8 @@ typedef struct {
     uint8_t genotype_survie;            ///< Genetic survival threshold (individual variations)
     uint8_t genotype_naissance;         ///< Genetic birth threshold
     uint8_t sante;                      ///< Health state (affected by nutrients and age)
-    RaceCellule race;                   ///< Cell race with specific properties
-    DirectionPolarisation polarisation; ///< Preferred movement direction
+    uint8_t race;                       ///< Cell race with specific properties (RaceCellule)
+    uint8_t polarisation;               ///< Preferred movement direction (DirectionPolarisation)
     uint8_t force_polarisation;         ///< Polarization intensity (0-255)
     uint8_t compteur_mouvement;         ///< Movement rhythm counter
     
@@ -140,6 +196,8 @@ typedef struct {
 /**
  * Local Environment Structure - Dynamic Ecosystem Factors
  * Represents local environmental pressures affecting cell survival
+ * Logical view of one site: the automaton stores these fields as separate
+ * arrays (see EnvironnementCellules), use lire_environnement / ecrire_environnement
  */
 typedef struct {
     uint8_t nutriments;                 ///< Available nutrient level (0-255)
@@ -150,20 +208,245 @@ typedef struct {
     uint8_t competition_territoriale;   ///< Territorial competition intensity (0-255)
 } EnvironnementLocal;
 
+/**
+ * Fertile neighbors of a dead cell, gathered by the birth branch
+ * Only built for cells whose neighbor count allows a birth attempt
+ */
+typedef struct {
+    uint8_t nombre_parents_fertiles;            ///< Living neighbors old enough to reproduce
+    uint32_t positions_parents[8];              ///< Grid positions of fertile neighbors, in raster order
+} VoisinageCellule;
+
+/**
+ * Inherited traits summed over the fertile parents of a newborn, in one pass
+ * over them instead of one loop per trait; the inheritance only divides
+ * The genotypes are summed modulo 256, like the 8-bit accumulators they replace
+ */
+typedef struct {
+    uint32_t age;                       ///< Sum of the parents' ages
+    uint32_t polarisation;              ///< Sum of their DirectionPolarisation values
+    uint32_t fitness_reproductif;
+    uint32_t efficacite_energetique;
+    uint32_t resistance_maladie;
+    uint32_t camouflage_predation;
+    uint8_t genotype_survie;
+    uint8_t genotype_naissance;
+    uint8_t race_dominante;             ///< Race of the first parent in raster order
+    uint8_t mixite;                     ///< 1 if some parent has another race
+} SommesHeritees;
+
+/**
+ * Hot per-cell state, read and written every generation
+ * Double-buffered: the automaton holds the current and the next generation
+ */
+typedef struct {
+    uint8_t *vivante;                   ///< Cell state: 0 = dead, 1 = alive
+    uint8_t *age;                       ///< Current age of the cell
+    uint8_t *sante;                     ///< Health state
+    uint8_t *compteur_mouvement;        ///< Movement rhythm counter
+} EtatCellules;
+
+/**
+ * Cold per-cell traits, only touched by births, inheritance reads and movement
+ * Single-buffered and indexed by position: a survivor keeps its traits in place
+ * and a birth only ever writes a site that is dead in the current generation
+ */
+typedef struct {
+    uint8_t *genotype_survie;           ///< Genetic survival threshold
+    uint8_t *genotype_naissance;        ///< Genetic birth threshold
+    uint8_t *race;                      ///< RaceCellule
+    uint8_t *polarisation;              ///< DirectionPolarisation
+    uint8_t *force_polarisation;        ///< Polarization intensity
+    uint8_t *fitness_reproductif;       ///< Reproductive fitness
+    uint8_t *efficacite_energetique;    ///< Resource utilization efficiency
+    uint8_t *espece_id;                 ///< Species identifier
+    uint8_t *resistance_maladie;        ///< Disease resistance level
+    uint8_t *camouflage_predation;      ///< Predation avoidance ability
+    uint8_t *territorialite;            ///< Territorial behavior strength
+    uint8_t *adaptabilite_stress;       ///< Stress adaptation capacity
+    uint8_t *generation_naissance;      ///< Generation when cell was born
+} TraitsCellules;
+
+/**
+ * Local environment of every site, one dense array per factor
+ * Rewritten as a whole each generation by the environment update, which can
+ * then process 16 consecutive sites per SSE2 instruction
+ */
+typedef struct {
+    uint8_t *nutriments;                ///< Available nutrient level
+    uint8_t *temperature;               ///< Environmental temperature factor
+    uint8_t *pression_predation;        ///< Current predation pressure
+    uint8_t *pathogenes_present;        ///< Disease pathogen presence
+    uint8_t *toxicite_locale;           ///< Local toxicity level
+    uint8_t *competition_territoriale;  ///< Territorial competition intensity
+} EnvironnementCellules;
+
+// Counter-based generator of the generation step: the k-th draw of a cell is a pure
+// function of (seed, generation, cell, k), whatever the order cells are visited in.
+// Counter = cell x EMPLACEMENTS_PAR_CELLULE + slot, distinct for grids up to 2^26 cells
+#define EMPLACEMENTS_PAR_CELLULE 64u
+#define EMPLACEMENT_MOUVEMENT 48u    // First slot of the movement phase (the cell update uses fewer)
+
+// Fixed-point scale of the evolutionary core: Q8 fractions (256 = 1.0)
+// Q8(reel) converts a constant at compile time, the generation step has no floating point
+#define Q8(reel) ((int)((reel) * 256.0 + 0.5))
+
+/**
+ * Cyclic environment scalars, computed once per generation (all factors in Q8)
+ * Everything that only depends on the generation number (sines of the
+ * predation, epidemic and energy cycles) instead of once per cell or parent
+ */
+typedef struct {
+    uint16_t intensite_predation;       ///< Predator cycle intensity (0.5 + 0.5 sin)
+    uint8_t pathogenes_dense;           ///< Pathogen level in dense blocks (3x3 count > 4)
+    uint8_t pathogenes_clairseme;       ///< Pathogen level elsewhere
+    uint16_t coefficient_energetique;   ///< Energy cycle factor used by the fitness
+    uint16_t bonus_nomade;              ///< Racial fitness bonus of RACE_NOMADE
+    uint16_t bonus_adaptatif;           ///< Racial fitness bonus of RACE_ADAPTATIVE
+} CyclesGeneration;
+
+/**
+ * What the birth branch needs from a fertile parent, filled once per generation
+ * while the occupancy plan is built: a live cell can be a parent of up to 8
+ * dead neighbors. Only the child-position niche term is left to the birth
+ */
+typedef struct {
+    uint16_t fertilite;                 ///< Fertility of the parent's age (Q8)
+    uint16_t fitness_base;              ///< FITNESS_AMPLITUDE x fertility x energy coefficient (Q8)
+    uint16_t bonus_efficacite;          ///< Energy efficiency bonus (Q8)
+    uint8_t race;                       ///< Race, selects the racial bonus
+    uint8_t reserve;                    ///< Padding to 8 bytes
+} CacheParent;
+
+// Occupancy bitplane: one bit per cell, each row padded to whole 32-bit words,
+// plus one halo row above and below (copy of the opposite row, or empty with BORD_FIXE)
+#define BITS_PAR_MOT 32
+#define MOTS_PAR_LIGNE(largeur) (((uint32_t)(largeur) + BITS_PAR_MOT - 1) / BITS_PAR_MOT)
+#define TAILLE_PLAN_OCCUPATION(largeur, hauteur) \
+    (((uint32_t)(hauteur) + 2) * MOTS_PAR_LIGNE(largeur) * sizeof(uint32_t))
+
+// Byte grid with a one-cell halo on every side: (largeur + 2) x (hauteur + 2)
+#define TAILLE_GRILLE_HALO(largeur, hauteur) (((uint32_t)(largeur) + 2) * ((uint32_t)(hauteur) + 2))
+
+// Activity tiles: one bitplane word wide (32 columns) and 32 rows high; a tile with
+// no living cell in it nor in its 8 neighbor tiles is skipped by the generation step
+#define COTE_TUILE BITS_PAR_MOT
+#define TUILES_PAR_COLONNE(hauteur) (((uint32_t)(hauteur) + COTE_TUILE - 1) / COTE_TUILE)
+#define NOMBRE_TUILES(largeur, hauteur) (MOTS_PAR_LIGNE(largeur) * TUILES_PAR_COLONNE(hauteur))
+
+// Sparse generations: the living cells are listed while they are at most 1/32 of the
+// grid (the list is entered again at half that, so the engine does not flip every
+// generation); their candidates (themselves and their neighbors) go to the per-site
+// lists of cellules_mobiles
+#define POPULATION_MAX_CLAIRSEMEE(largeur, hauteur) (((uint32_t)(largeur) * (uint32_t)(hauteur)) / 32)
+#define TAILLE_LISTES_CLAIRSEMEES(largeur, hauteur) \
+    (POPULATION_MAX_CLAIRSEMEE(largeur, hauteur) * sizeof(uint32_t))
+
+// Bytes per cell: 2 x 4 hot arrays, 13 cold arrays, the 3x3 count, the local environment,
+// the nutrient demand, the two static spatial fields (Q8), the parent cache and the per-site lists
+#define OCTETS_PAR_CELLULE (2 * 4 + 13 + 1 + sizeof(EnvironnementLocal) + 1 + 2 * sizeof(uint16_t) + \
+                            sizeof(CacheParent) + sizeof(uint32_t))
+
+// Temporal blocking of MOTEUR_BITBOARD (see avancer_generations): bands of
+// LIGNES_BANDE_TEMPORELLE rows advance up to PROFONDEUR_TEMPORELLE_MAX generations in
+// two scratch bands, which also hold one halo row per generation above and below
+#define PROFONDEUR_TEMPORELLE_MAX 8
+#define LIGNES_BANDE_TEMPORELLE 64
+#define TAILLE_BANDES_TEMPORELLES(largeur) \
+    (2 * (LIGNES_BANDE_TEMPORELLE + 2 * PROFONDEUR_TEMPORELLE_MAX) * MOTS_PAR_LIGNE(largeur) * sizeof(uint32_t))
+
+// Arrays of one MOTEUR_EVOLUTIF grid, rounded up to 16 bytes so that grids can follow it
+#define TAILLE_GRILLE_EVOLUTIVE(largeur, hauteur) \
+    ((TAILLE_PLAN_OCCUPATION(largeur, hauteur) + \
+      (uint32_t)(largeur) * (uint32_t)(hauteur) * OCTETS_PAR_CELLULE + \
+      TAILLE_GRILLE_HALO(largeur, hauteur) + 4 * NOMBRE_TUILES(largeur, hauteur) + \
+      TAILLE_LISTES_CLAIRSEMEES(largeur, hauteur) + 15u) & ~15u)
+
+// Temporal blocking of MOTEUR_EVOLUTIF: bands of LIGNES_BANDE_EVOLUTIVE rows advance in
+// scratch grids with one halo row per generation above and below, two more for the
+// movement phase (it runs every 10 generations, so at most once per
+// PROFONDEUR_TEMPORELLE_MAX). Three scratch grids: on a torus the first band is only
+// written back after the last one has read its rows. A grid lower than a scratch grid
+// gains nothing from it and gets none
+#define LIGNES_BANDE_EVOLUTIVE 64
+#define HALO_EVOLUTIF_MAX (PROFONDEUR_TEMPORELLE_MAX + 2)
+#define LIGNES_GRILLE_TRAVAIL (LIGNES_BANDE_EVOLUTIVE + 2 * HALO_EVOLUTIF_MAX)
+#define TAILLE_GRILLES_TRAVAIL(largeur, hauteur) \
+    (((uint32_t)(hauteur) < LIGNES_GRILLE_TRAVAIL) ? 0u : 3 * TAILLE_GRILLE_EVOLUTIVE(largeur, LIGNES_GRILLE_TRAVAIL))
+
+// Size of the memory block to give to attacher_memoire_automate (usable for static arrays)
+// TAILLE_MEMOIRE_AUTOMATE is also enough for MOTEUR_BITBOARD, which only needs two
+// bitplanes and the scratch bands
+#define TAILLE_MEMOIRE_BITBOARD(largeur, hauteur) \
+    (2 * TAILLE_PLAN_OCCUPATION(largeur, hauteur) + TAILLE_BANDES_TEMPORELLES(largeur))
+#define TAILLE_MEMOIRE_AUTOMATE(largeur, hauteur) \
+    (TAILLE_GRILLE_EVOLUTIVE(largeur, hauteur) + TAILLE_GRILLES_TRAVAIL(largeur, hauteur))
+
 // Main evolutionary cellular automaton structure
 typedef struct {
     int largeur_grille;                    // Number of columns in the grid
     int hauteur_grille;                    // Number of rows in the grid
     const char *regles_format_texte;       // Base rules in "B3/S23" format
+    MoteurAutomate moteur;                 // Engine (MOTEUR_EVOLUTIF by default)
+    BordAutomate bord;                     // Boundary (BORD_TORIQUE by default)
+    StockageAutomate stockage;             // Cell storage of MOTEUR_EVOLUTIF (STOCKAGE_AUTOMATIQUE by default)
     uint16_t masque_conditions_naissance;  // Base masks (can be modified by genotype)
     uint16_t masque_conditions_survie;     // Base masks
-    CelluleEvolutive *grille_cellules_actuelles;     // Grid of cells with properties
-    CelluleEvolutive *grille_cellules_suivantes;     // Temporary grid for calculations
-    EnvironnementLocal *grille_environnement;        // Environment of each cell
+    uint8_t table_transition[2][9];        // [alive][neighbors]: 1 if alive next generation is possible
+    EtatCellules etat_actuel;                        // Hot state of the current generation
+    EtatCellules etat_suivant;                       // Hot state being computed
+    TraitsCellules traits;                           // Cold traits, updated in place
+    uint32_t *plan_occupation;                       // 1 bit per living cell (rebuilt by each dense generation in MOTEUR_EVOLUTIF), row 0
+    uint32_t *plan_suivant;                          // Next bitplane (MOTEUR_BITBOARD only), row 0
+    uint32_t *bandes_temporelles;                    // Two scratch bands of the temporal blocking (MOTEUR_BITBOARD only)
+    uint8_t *grilles_travail;                        // Three scratch grids of the temporal blocking (MOTEUR_EVOLUTIF), NULL if none
+    int ligne_origine;                               // Scratch grid: row of the whole grid that is its row 0
+    int hauteur_origine;                             // Scratch grid: height of the whole grid (0 outside scratch grids)
+    uint8_t *densite_voisinage;                      // Living cells in each 3x3 block (self included)
+    EnvironnementCellules environnement;             // Environment of each cell
+    uint8_t *demande_nutriments;                     // Nutrients each cell uses this generation, subtracted once all cells are updated
+    uint8_t *parents_potentiels;                     // Living and fertile cells, haloed grid (rebuilt each generation)
+    uint16_t *gradient_predation;                    // Static spatial predation factor, Q8 (higher at edges)
+    uint16_t *niche_ecologique;                      // Static spatial fitness factor, Q8 (higher at the center)
+    CyclesGeneration cycles;                         // Cyclic scalars of the current generation
+    CacheParent *cache_parents;                      // Per-generation parent terms (valid where parents_potentiels is set)
+    uint32_t *cellules_mobiles;                      // Per-site lists, each part in its own rows: cells of a block, sparse candidates, claimed targets
+    uint8_t *tuiles_peuplees;                        // Tiles holding at least one living cell (rebuilt with the bitplane)
+    uint8_t *tuiles_actives;                         // Populated tiles and their 8 neighbors: the others are skipped
+    uint8_t *tuiles_differees;                       // Empty tiles whose environment is kept as one nutrient level (see lire_environnement)
+    uint8_t *nutriments_tuiles;                      // Nutrient level shared by every site of a deferred tile
+    uint32_t tuiles_calculees;                       // Tiles whose cells were updated by the last generation
+    uint32_t tuiles_environnement;                   // Tiles whose environment was updated by the last generation
+    uint32_t *cellules_vivantes;                     // Positions of the living cells, in no particular order (sparse generations)
+    uint32_t nombre_cellules_vivantes;               // Entries of cellules_vivantes
+    uint8_t mode_clairseme;                          // 1 while cellules_vivantes is up to date and the next generation is sparse
+    uint8_t generation_clairsemee;                   // 1 if the last generation ran on the lists
+    uint32_t graine_aleatoire;                        // Seed given to the initialization, keys the generation-step draws
     uint32_t generation_actuelle;                     // Generation counter
     uint32_t population_totale;                       // Number of living cells
 } AutomateCellulaire;
 
+// =============================
+// MEMORY AND CELL ACCESS
+// =============================
+
+// Memory needed for a grid with the given engine, 0 if the size is invalid
+uint32_t calculer_taille_memoire_automate(int largeur, int hauteur, MoteurAutomate moteur);
+
+// Carves all grid arrays out of one caller-provided block of
+// calculer_taille_memoire_automate bytes; largeur_grille, hauteur_grille and moteur must be set
+void attacher_memoire_automate(AutomateCellulaire *automate, uint8_t *zone_memoire);
+
+// Gathers / scatters the logical view of the cell at "position" (current generation)
+// With MOTEUR_BITBOARD only "vivante" is stored, the other fields read as 0
+void lire_cellule(const AutomateCellulaire *automate, int position, CelluleEvolutive *cellule);
+void ecrire_cellule(AutomateCellulaire *automate, int position, const CelluleEvolutive *cellule);
+
+// Same for the local environment of the site at "position" (MOTEUR_EVOLUTIF only);
+// the arrays of an empty tile lag behind while it is deferred, these do not
+void lire_environnement(const AutomateCellulaire *automate, int position, EnvironnementLocal *environnement);
+void ecrire_environnement(AutomateCellulaire *automate, int position, const EnvironnementLocal *environnement);
+
 // Analyzes the rule string and fills the condition masks
 // Example: "B3/S23" means birth with 3 neighbors, survival with 2 or 3 neighbors
 void analyser_regles_automate(AutomateCellulaire *automate);
@@ -188,6 +471,177 @@ void initialiser_grille_aleatoire(AutomateCellulaire *automate, uint32_t graine_
 // This is the heart of the simulation: counts neighbors and applies rules
 void calculer_generation_suivante(AutomateCellulaire *automate);
 
+// Advances "nombre_generations" generations, with the same result as as many calls to
+// calculer_generation_suivante. With profondeur > 1, each band of rows advances up to
+// "profondeur" generations (at most PROFONDEUR_TEMPORELLE_MAX) while it stays in cache,
+// so the grid goes through memory once per "profondeur". MOTEUR_EVOLUTIF needs its
+// scratch grids (see TAILLE_GRILLES_TRAVAIL), otherwise it advances one generation at a time
+void avancer_generations(AutomateCellulaire *automate, uint32_t nombre_generations, uint32_t profondeur);
+
+// =============================
+// GENERATION SHARED BETWEEN PROCESSORS
+// =============================
+// calculer_generation_suivante in stages, for a caller that spreads them over several
+// processors. debuter_generation_partagee runs on one processor and returns the number
+// of stages; each stage then runs once per part (contiguous ranges of rows, so up to
+// one row per part), on any processor, and every part of a stage must be done before
+// any part of the next one starts (e.g. a barrier after each stage); then
+// terminer_generation_partagee runs on one processor. Within a stage the parts only
+// write their own rows and tiles and draw from per-cell streams: the result is the one
+// of a single call, whatever the number of parts and their order within a stage.
+// Stages: occupation plane and parents (or sparse neighbor counts), halo rows and
+// populated tiles, active and deferred tiles, new state of the rows, deferred tiles
+// again; on movement generations, the buffer swap (part 0 only), then the intents,
+// claims and moves of the movement phase.
+
+// What a part reports, read by the next stages and terminer_generation_partagee
+typedef struct {
+    uint32_t population;            // Living cells written by the part
+    uint32_t tuiles_calculees;      // Active tiles of its bands (dense generation)
+    uint32_t tuiles_environnement;  // Tiles of its bands whose environment was updated
+    uint32_t nombre_candidates;     // Sparse generation: candidates of its rows
+    uint32_t nombre_cibles;         // Movement phase: targets claimed in its rows
+} BilanPartGeneration;
+
+// Storage choice and cyclic scalars; returns the number of stages of the generation
+uint32_t debuter_generation_partagee(AutomateCellulaire *automate);
+
+// Stage "etape" for part "part" of "nombre_parts", reporting in bilans[part] (the
+// buffer swap stage reads every report); may run at the same time as the other parts
+// of the same stage
+void calculer_etape_generation(AutomateCellulaire *automate, uint32_t etape, uint32_t part, uint32_t nombre_parts,
+                               BilanPartGeneration bilans[]);
+
+// Buffer swap (unless the movement phase ran), sparse list and generation counter
+void terminer_generation_partagee(AutomateCellulaire *automate, const BilanPartGeneration bilans[],
+                                  uint32_t nombre_parts);
+
+// =============================
+// INDIVIDUAL PIPELINE PHASES (instrumentation / benchmarks)
+// =============================
+// Each function runs one stage of calculer_generation_suivante over the whole grid,
+// so that stages can be timed in isolation. They do not swap buffers nor advance
+// the generation counter. The next generation after one of them sweeps the whole grid.
+
+// Environment update (nutrients, predation, pathogens, toxicity)
+void executer_phase_environnement(AutomateCellulaire *automate);
+
+// Occupancy bitplane and bit-parallel 3x3 counts for every cell (densite_voisinage)
+void executer_phase_voisinage(AutomateCellulaire *automate);
+
+// Survival branch on living cells only, from the counts of executer_phase_voisinage
+// (each cell's nutrient demand is subtracted right after its update)
+void executer_phase_survie(AutomateCellulaire *automate);
+
+// Birth branch on dead cells only (fitness, inheritance), from the same counts
+void executer_phase_naissance(AutomateCellulaire *automate);
+
+// Polarized movement over the current grid (normally every 10 generations)
+void executer_phase_mouvement(AutomateCellulaire *automate);
+
+// =============================
+// VECTOR KERNELS (SSE2)
+// =============================
+// The neighbor count unpacking and the environment update have an SSE2 variant
+// working on 16 cells per instruction, with the same results as the scalar code.
+// The choice is made at run time: the i386 kernel is built without SSE so that
+// it boots on any processor, and may only use it once kmain has enabled it.
+
+// CPUID leaf 1, EDX feature bits
+#define CPUID_FXSR (1u << 24)   ///< FXSAVE / FXRSTOR
+#define CPUID_SSE  (1u << 25)
+#define CPUID_SSE2 (1u << 26)
+
+// CPUID leaf 1 EDX of the running processor, 0 without CPUID (or on a non-x86 host)
+uint32_t lire_capacites_processeur(void);
+
+// Asks for the SSE2 kernels (demande != 0) or the scalar ones; returns 1 if the SSE2
+// kernels are now in use, i.e. they were asked for and the processor reports SSE2.
+// The caller vouches for the OS side (CR0 / CR4 set up on bare metal).
+// Default: SSE2 on x86-64 hosts, where it is part of the ABI, scalar elsewhere
+int selectionner_noyau_sse2(int demande);
+
+// =============================
+// HASHLIFE ENGINE (hashlife.c)
+// =============================
+// Memoized quadtree for plain B/S rules (B0 excluded) on an unbounded plane.
+// Nodes live in a fixed caller-provided arena with a chained hash table; when
+// the arena fills up, nodes unreachable from the root are compacted away.
+// The plane is centered on (0,0): the root covers [-2^(niveau-1), 2^(niveau-1)).
+
+#define NIVEAU_MAX_HASHLIFE 60        // Deepest root allowed (coordinates stay in int64_t)
+#define NOEUD_HASHLIFE_AUCUN 0xFFFFFFFFu
+
+/**
+ * Quadtree node: a 2^niveau square made of four 2^(niveau-1) children
+ * Level-0 nodes are the two cells: index 0 = dead, index 1 = alive
+ */
+typedef struct {
+    uint32_t enfants[4];                ///< Children indices: nw, ne, sw, se
+    uint32_t resultat;                  ///< Memoized center after 2^pas_resultat generations
+    uint32_t suivant;                   ///< Next node in the same hash bucket
+    uint64_t population;                ///< Living cells in the square
+    uint8_t niveau;                     ///< log2 of the side
+    uint8_t pas_resultat;               ///< log2 of the step memoized in resultat
+    uint8_t marque;                     ///< Reachability mark (compaction)
+} NoeudHashLife;
+
+typedef struct {
+    NoeudHashLife *noeuds;              ///< Node arena
+    uint32_t *renvois;                  ///< Forwarding indices used by compaction
+    uint32_t *table_hachage;            ///< Bucket heads (NOEUD_HASHLIFE_AUCUN = empty)
+    uint32_t capacite_noeuds;           ///< Arena size in nodes
+    uint32_t nombre_noeuds;             ///< Nodes in use
+    uint32_t masque_hachage;            ///< Bucket count - 1 (power of two)
+    uint32_t racine;                    ///< Root node
+    uint32_t vides[NIVEAU_MAX_HASHLIFE + 1];  ///< Canonical empty node per level
+    uint16_t masque_conditions_naissance;     ///< Same masks as AutomateCellulaire
+    uint16_t masque_conditions_survie;
+    uint64_t generation;                ///< Generations elapsed since charger_hashlife
+    int saturation;                     ///< Set when the arena ran out during a step
+} UniversHashLife;
+
+// Bytes taken by one node (arena + forwarding + hash bucket)
+#define OCTETS_PAR_NOEUD_HASHLIFE (sizeof(NoeudHashLife) + 2 * sizeof(uint32_t))
+
+// Carves the arena out of a caller-provided block; returns 0 if it is too small
+int attacher_memoire_hashlife(UniversHashLife *univers, uint8_t *zone_memoire, uint32_t taille_octets);
+
+// Takes the rule masks and the living cells of any engine, grid centered on (0,0)
+// Returns 0 for B0 rules (not representable on an unbounded plane) or a full arena
+int charger_hashlife(UniversHashLife *univers, const AutomateCellulaire *automate);
+
+// Advances 2^log2_generations generations at once; returns 0 if the arena is too small
+int avancer_hashlife(UniversHashLife *univers, uint32_t log2_generations);
+
+// Advances any number of generations (sum of powers of two); returns 0 on failure
+int avancer_hashlife_generations(UniversHashLife *univers, uint64_t generations);
+
+// Living cells of the whole plane
+uint64_t population_hashlife(const UniversHashLife *univers);
+
+// Copies the viewport whose top-left corner is (x, y) into "vue" (largeur_grille x hauteur_grille,
+// any engine) so that afficher_grille_sur_ecran can draw it; also sets its population and generation
+void rasteriser_hashlife(const UniversHashLife *univers, int64_t x, int64_t y, AutomateCellulaire *vue);
+
+// =============================
+// STATE FINGERPRINT (equivalence checking)
+// =============================
+// 64-bit FNV-1a fingerprint of the simulation state, built in a fixed canonical
+// order so that any engine (or the hosted reference kernel) can reproduce it.
+// Dead cells only contribute their state bit: their other fields are never read.
+// With MOTEUR_BITBOARD the fingerprint only covers the state bit of every cell.
+
+// Starts a fingerprint with the generation counter and population
+uint64_t empreinte_debut(uint32_t generation, uint32_t population);
+
+// Folds one cell and its local environment into the fingerprint
+uint64_t empreinte_ajouter_cellule(uint64_t empreinte, const CelluleEvolutive *cellule,
+                                   const EnvironnementLocal *environnement);
+
+// Fingerprint of the whole current state (cells in raster order, then environment)
+uint64_t calculer_empreinte_etat(const AutomateCellulaire *automate);
+
 // Displays the current grid in VGA memory (text mode)
 // Uses race characters for living cells and ' ' for dead cells
 void afficher_grille_sur_ecran(const AutomateCellulaire *automate, volatile uint8_t *memoire_vga);
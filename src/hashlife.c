@@ -0,0 +1,436 @@
+#include "ca.h"
+
+// =============================
+// HASHLIFE : QUADTREE MÉMOÏSÉ POUR LES RÈGLES B/S PURES
+// =============================
+// Chaque carré de 2^n cellules est un noeud unique (hash-consing) : un motif
+// répété n'est stocké et calculé qu'une fois. Le résultat d'un noeud (son centre
+// avancé de 2^pas générations) est mémorisé dans le noeud lui-même.
+
+#define NIVEAU_MIN_RACINE 3
+
+static uint32_t hacher_enfants(uint32_t nw, uint32_t ne, uint32_t sw, uint32_t se) {
+    uint32_t h = nw * 0x9E3779B1u;
+    h = (h ^ (h >> 15)) + ne * 0x85EBCA77u;
+    h = (h ^ (h >> 13)) + sw * 0xC2B2AE3Du;
+    h = (h ^ (h >> 16)) + se * 0x27D4EB2Fu;
+    return h ^ (h >> 15);
+}
+
+// Noeud unique pour ces quatre enfants ; marque la saturation si l'arène est pleine
+static uint32_t creer_noeud(UniversHashLife *univers, uint32_t nw, uint32_t ne, uint32_t sw, uint32_t se) {
+    uint32_t *tete = &univers->table_hachage[hacher_enfants(nw, ne, sw, se) & univers->masque_hachage];
+
+    for (uint32_t indice = *tete; indice != NOEUD_HASHLIFE_AUCUN; indice = univers->noeuds[indice].suivant) {
+        const uint32_t *enfants = univers->noeuds[indice].enfants;
+        if (enfants[0] == nw && enfants[1] == ne && enfants[2] == sw && enfants[3] == se) return indice;
+    }
+
+    if (univers->nombre_noeuds >= univers->capacite_noeuds) {
+        univers->saturation = 1;
+        return 0;  // Valeur quelconque : le pas en cours sera abandonné
+    }
+
+    uint32_t indice = univers->nombre_noeuds++;
+    NoeudHashLife *noeud = &univers->noeuds[indice];
+    noeud->enfants[0] = nw;
+    noeud->enfants[1] = ne;
+    noeud->enfants[2] = sw;
+    noeud->enfants[3] = se;
+    noeud->resultat = NOEUD_HASHLIFE_AUCUN;
+    noeud->pas_resultat = 0;
+    noeud->marque = 0;
+    noeud->niveau = univers->noeuds[nw].niveau + 1;
+    noeud->population = univers->noeuds[nw].population + univers->noeuds[ne].population +
+                        univers->noeuds[sw].population + univers->noeuds[se].population;
+    noeud->suivant = *tete;
+    *tete = indice;
+    return indice;
+}
+
+// Repart d'une arène vide : les deux cellules puis un carré vide par niveau
+static void reinitialiser_univers(UniversHashLife *univers) {
+    for (uint32_t seau = 0; seau <= univers->masque_hachage; seau++) {
+        univers->table_hachage[seau] = NOEUD_HASHLIFE_AUCUN;
+    }
+
+    for (uint32_t cellule = 0; cellule < 2; cellule++) {
+        NoeudHashLife *feuille = &univers->noeuds[cellule];
+        feuille->enfants[0] = feuille->enfants[1] = feuille->enfants[2] = feuille->enfants[3] = 0;
+        feuille->resultat = NOEUD_HASHLIFE_AUCUN;
+        feuille->suivant = NOEUD_HASHLIFE_AUCUN;
+        feuille->population = cellule;
+        feuille->niveau = 0;
+        feuille->pas_resultat = 0;
+        feuille->marque = 0;
+    }
+    univers->nombre_noeuds = 2;
+    univers->saturation = 0;
+    univers->generation = 0;
+
+    univers->vides[0] = 0;
+    for (int niveau = 1; niveau <= NIVEAU_MAX_HASHLIFE; niveau++) {
+        uint32_t vide = univers->vides[niveau - 1];
+        univers->vides[niveau] = creer_noeud(univers, vide, vide, vide, vide);
+    }
+    univers->racine = univers->vides[NIVEAU_MIN_RACINE];
+}
+
+int attacher_memoire_hashlife(UniversHashLife *univers, uint8_t *zone_memoire, uint32_t taille_octets) {
+    if (!univers || !zone_memoire) return 0;
+
+    uint32_t capacite = taille_octets / OCTETS_PAR_NOEUD_HASHLIFE;
+    if (capacite < 4 * NIVEAU_MAX_HASHLIFE) return 0;
+
+    // Plus grande puissance de deux <= capacité pour la table (chaînage, charge <= 2)
+    uint32_t nombre_seaux = 1;
+    while (nombre_seaux <= capacite / 2) nombre_seaux <<= 1;
+
+    univers->noeuds = (NoeudHashLife*)zone_memoire;
+    univers->renvois = (uint32_t*)(zone_memoire + capacite * sizeof(NoeudHashLife));
+    univers->table_hachage = univers->renvois + capacite;
+    univers->capacite_noeuds = capacite;
+    univers->masque_hachage = nombre_seaux - 1;
+    univers->masque_conditions_naissance = 0;
+    univers->masque_conditions_survie = 0;
+
+    reinitialiser_univers(univers);
+    return 1;
+}
+
+// =============================
+// COMPACTION (ARÈNE PLEINE)
+// =============================
+
+static void marquer_noeud(UniversHashLife *univers, uint32_t indice) {
+    NoeudHashLife *noeud = &univers->noeuds[indice];
+    if (noeud->marque) return;
+    noeud->marque = 1;
+    if (noeud->niveau == 0) return;
+    for (int enfant = 0; enfant < 4; enfant++) marquer_noeud(univers, noeud->enfants[enfant]);
+}
+
+/**
+ * Keeps only the nodes reachable from the root and the empty squares, slid down
+ * in index order (children are always older than their parents), then rebuilds
+ * the hash table; memoized results are dropped
+ */
+static void compacter_univers(UniversHashLife *univers) {
+    univers->noeuds[0].marque = 1;
+    univers->noeuds[1].marque = 1;
+    marquer_noeud(univers, univers->racine);
+    for (int niveau = 0; niveau <= NIVEAU_MAX_HASHLIFE; niveau++) marquer_noeud(univers, univers->vides[niveau]);
+
+    uint32_t conserves = 0;
+    for (uint32_t indice = 0; indice < univers->nombre_noeuds; indice++) {
+        NoeudHashLife noeud = univers->noeuds[indice];
+        if (!noeud.marque) continue;
+
+        univers->renvois[indice] = conserves;
+        if (noeud.niveau > 0) {
+            for (int enfant = 0; enfant < 4; enfant++) noeud.enfants[enfant] = univers->renvois[noeud.enfants[enfant]];
+        }
+        noeud.resultat = NOEUD_HASHLIFE_AUCUN;
+        noeud.marque = 0;
+        univers->noeuds[conserves++] = noeud;
+    }
+    univers->nombre_noeuds = conserves;
+
+    for (uint32_t seau = 0; seau <= univers->masque_hachage; seau++) {
+        univers->table_hachage[seau] = NOEUD_HASHLIFE_AUCUN;
+    }
+    for (uint32_t indice = 2; indice < conserves; indice++) {
+        NoeudHashLife *noeud = &univers->noeuds[indice];
+        uint32_t *tete = &univers->table_hachage[hacher_enfants(noeud->enfants[0], noeud->enfants[1],
+                                                                noeud->enfants[2], noeud->enfants[3]) &
+                                                 univers->masque_hachage];
+        noeud->suivant = *tete;
+        *tete = indice;
+    }
+
+    univers->racine = univers->renvois[univers->racine];
+    for (int niveau = 0; niveau <= NIVEAU_MAX_HASHLIFE; niveau++) {
+        univers->vides[niveau] = univers->renvois[univers->vides[niveau]];
+    }
+    univers->saturation = 0;
+}
+
+// =============================
+// CHARGEMENT ET RASTÉRISATION
+// =============================
+
+typedef struct {
+    const AutomateCellulaire *automate;
+    int64_t x_grille, y_grille;         // Coin haut-gauche de la grille dans le plan
+} SourceGrille;
+
+// Construit le carré de 2^niveau cellules dont le coin haut-gauche est (x, y)
+static uint32_t construire_depuis_grille(UniversHashLife *univers, const SourceGrille *source,
+                                         int niveau, int64_t x, int64_t y) {
+    int64_t cote = (int64_t)1 << niveau;
+    int64_t largeur = source->automate->largeur_grille, hauteur = source->automate->hauteur_grille;
+    if (x + cote <= source->x_grille || x >= source->x_grille + largeur ||
+        y + cote <= source->y_grille || y >= source->y_grille + hauteur) {
+        return univers->vides[niveau];
+    }
+
+    if (niveau == 0) {
+        CelluleEvolutive cellule;
+        int position = (int)((y - source->y_grille) * largeur + (x - source->x_grille));
+        lire_cellule(source->automate, position, &cellule);
+        return cellule.vivante ? 1 : 0;
+    }
+
+    int64_t moitie = cote >> 1;
+    uint32_t nw = construire_depuis_grille(univers, source, niveau - 1, x, y);
+    uint32_t ne = construire_depuis_grille(univers, source, niveau - 1, x + moitie, y);
+    uint32_t sw = construire_depuis_grille(univers, source, niveau - 1, x, y + moitie);
+    uint32_t se = construire_depuis_grille(univers, source, niveau - 1, x + moitie, y + moitie);
+    return creer_noeud(univers, nw, ne, sw, se);
+}
+
+int charger_hashlife(UniversHashLife *univers, const AutomateCellulaire *automate) {
+    if (!univers || !univers->noeuds || !automate) return 0;
+    if (automate->masque_conditions_naissance & 1u) return 0;  // B0 : le vide infini s'allumerait
+
+    reinitialiser_univers(univers);
+    univers->masque_conditions_naissance = automate->masque_conditions_naissance;
+    univers->masque_conditions_survie = automate->masque_conditions_survie;
+
+    // Racine assez grande pour contenir la grille centrée sur (0,0)
+    int niveau = NIVEAU_MIN_RACINE;
+    int cote_max = (automate->largeur_grille > automate->hauteur_grille) ?
+                   automate->largeur_grille : automate->hauteur_grille;
+    while (((int64_t)1 << (niveau - 1)) < cote_max) niveau++;
+
+    SourceGrille source = {
+        .automate = automate,
+        .x_grille = -(int64_t)(automate->largeur_grille / 2),
+        .y_grille = -(int64_t)(automate->hauteur_grille / 2)
+    };
+    int64_t demi_cote = (int64_t)1 << (niveau - 1);
+    uint32_t racine = construire_depuis_grille(univers, &source, niveau, -demi_cote, -demi_cote);
+    if (univers->saturation) {
+        reinitialiser_univers(univers);
+        return 0;
+    }
+    univers->racine = racine;
+    return 1;
+}
+
+typedef struct {
+    AutomateCellulaire *vue;
+    int64_t x_vue, y_vue;               // Coin haut-gauche de la fenêtre dans le plan
+    uint32_t population;
+} DestinationVue;
+
+static void rasteriser_noeud(const UniversHashLife *univers, DestinationVue *destination,
+                             uint32_t indice, int64_t x, int64_t y) {
+    const NoeudHashLife *noeud = &univers->noeuds[indice];
+    int64_t cote = (int64_t)1 << noeud->niveau;
+    int64_t largeur = destination->vue->largeur_grille, hauteur = destination->vue->hauteur_grille;
+    if (noeud->population == 0 ||
+        x + cote <= destination->x_vue || x >= destination->x_vue + largeur ||
+        y + cote <= destination->y_vue || y >= destination->y_vue + hauteur) {
+        return;
+    }
+
+    if (noeud->niveau == 0) {
+        CelluleEvolutive cellule = {0};
+        cellule.vivante = 1;
+        cellule.sante = 100;
+        ecrire_cellule(destination->vue, (int)((y - destination->y_vue) * largeur + (x - destination->x_vue)), &cellule);
+        destination->population++;
+        return;
+    }
+
+    int64_t moitie = cote >> 1;
+    rasteriser_noeud(univers, destination, noeud->enfants[0], x, y);
+    rasteriser_noeud(univers, destination, noeud->enfants[1], x + moitie, y);
+    rasteriser_noeud(univers, destination, noeud->enfants[2], x, y + moitie);
+    rasteriser_noeud(univers, destination, noeud->enfants[3], x + moitie, y + moitie);
+}
+
+void rasteriser_hashlife(const UniversHashLife *univers, int64_t x, int64_t y, AutomateCellulaire *vue) {
+    if (!univers || !univers->noeuds || !vue) return;
+
+    CelluleEvolutive morte = {0};
+    int taille_totale = vue->largeur_grille * vue->hauteur_grille;
+    for (int position = 0; position < taille_totale; position++) {
+        ecrire_cellule(vue, position, &morte);
+    }
+
+    DestinationVue destination = { .vue = vue, .x_vue = x, .y_vue = y, .population = 0 };
+    int64_t demi_cote = (int64_t)1 << (univers->noeuds[univers->racine].niveau - 1);
+    rasteriser_noeud(univers, &destination, univers->racine, -demi_cote, -demi_cote);
+
+    vue->population_totale = destination.population;
+    vue->generation_actuelle = (uint32_t)univers->generation;
+}
+
+uint64_t population_hashlife(const UniversHashLife *univers) {
+    if (!univers || !univers->noeuds) return 0;
+    return univers->noeuds[univers->racine].population;
+}
+
+// =============================
+// ÉVOLUTION
+// =============================
+
+// Carré central de 2^(n-1) d'un noeud de niveau n
+static uint32_t centre_noeud(UniversHashLife *univers, uint32_t indice) {
+    const uint32_t *enfants = univers->noeuds[indice].enfants;
+    return creer_noeud(univers, univers->noeuds[enfants[0]].enfants[3], univers->noeuds[enfants[1]].enfants[2],
+                       univers->noeuds[enfants[2]].enfants[1], univers->noeuds[enfants[3]].enfants[0]);
+}
+
+// Carré à cheval sur deux voisins horizontaux (ouest, est)
+static uint32_t centre_horizontal(UniversHashLife *univers, uint32_t ouest, uint32_t est) {
+    const uint32_t *o = univers->noeuds[ouest].enfants, *e = univers->noeuds[est].enfants;
+    return creer_noeud(univers, o[1], e[0], o[3], e[2]);
+}
+
+// Carré à cheval sur deux voisins verticaux (nord, sud)
+static uint32_t centre_vertical(UniversHashLife *univers, uint32_t nord, uint32_t sud) {
+    const uint32_t *n = univers->noeuds[nord].enfants, *s = univers->noeuds[sud].enfants;
+    return creer_noeud(univers, n[2], n[3], s[0], s[1]);
+}
+
+// Cas de base : carré 4x4 → ses 2x2 cellules centrales une génération plus tard
+static uint32_t avancer_niveau_2(UniversHashLife *univers, uint32_t indice) {
+    uint8_t cellules[4][4];
+    const uint32_t *quadrants = univers->noeuds[indice].enfants;
+    for (int quadrant = 0; quadrant < 4; quadrant++) {
+        const uint32_t *feuilles = univers->noeuds[quadrants[quadrant]].enfants;
+        int ligne = (quadrant >> 1) * 2, colonne = (quadrant & 1) * 2;
+        cellules[ligne][colonne]         = (uint8_t)feuilles[0];
+        cellules[ligne][colonne + 1]     = (uint8_t)feuilles[1];
+        cellules[ligne + 1][colonne]     = (uint8_t)feuilles[2];
+        cellules[ligne + 1][colonne + 1] = (uint8_t)feuilles[3];
+    }
+
+    uint32_t resultat[4];
+    for (int cellule = 0; cellule < 4; cellule++) {
+        int ligne = 1 + (cellule >> 1), colonne = 1 + (cellule & 1);
+        int voisins = 0;
+        for (int dy = -1; dy <= 1; dy++) {
+            for (int dx = -1; dx <= 1; dx++) {
+                if (dx != 0 || dy != 0) voisins += cellules[ligne + dy][colonne + dx];
+            }
+        }
+        uint16_t masque = cellules[ligne][colonne] ? univers->masque_conditions_survie
+                                                   : univers->masque_conditions_naissance;
+        resultat[cellule] = (masque >> voisins) & 1u;
+    }
+    return creer_noeud(univers, resultat[0], resultat[1], resultat[2], resultat[3]);
+}
+
+/**
+ * Center of a level-n node (n >= 2) after 2^pas generations, pas <= n-2
+ * With pas = n-2 both halves of the step are recursive (full speed); with a
+ * smaller step the nine overlapping sub-squares are only re-centered first
+ */
+static uint32_t avancer_noeud(UniversHashLife *univers, uint32_t indice, int pas) {
+    if (univers->saturation) return 0;
+
+    NoeudHashLife *noeud = &univers->noeuds[indice];
+    int niveau = noeud->niveau;
+    if (noeud->population == 0) return univers->vides[niveau - 1];
+    if (noeud->resultat != NOEUD_HASHLIFE_AUCUN && noeud->pas_resultat == pas) return noeud->resultat;
+
+    uint32_t resultat;
+    if (niveau == 2) {
+        resultat = avancer_niveau_2(univers, indice);
+    } else {
+        uint32_t nw = noeud->enfants[0], ne = noeud->enfants[1], sw = noeud->enfants[2], se = noeud->enfants[3];
+        uint32_t carres[9] = {
+            nw,                                     centre_horizontal(univers, nw, ne), ne,
+            centre_vertical(univers, nw, sw),       centre_noeud(univers, indice),      centre_vertical(univers, ne, se),
+            sw,                                     centre_horizontal(univers, sw, se), se
+        };
+
+        int pleine_vitesse = (pas == niveau - 2);
+        for (int carre = 0; carre < 9; carre++) {
+            carres[carre] = pleine_vitesse ? avancer_noeud(univers, carres[carre], pas - 1)
+                                           : centre_noeud(univers, carres[carre]);
+        }
+
+        int pas_restant = pleine_vitesse ? pas - 1 : pas;
+        uint32_t c00 = creer_noeud(univers, carres[0], carres[1], carres[3], carres[4]);
+        uint32_t c01 = creer_noeud(univers, carres[1], carres[2], carres[4], carres[5]);
+        uint32_t c10 = creer_noeud(univers, carres[3], carres[4], carres[6], carres[7]);
+        uint32_t c11 = creer_noeud(univers, carres[4], carres[5], carres[7], carres[8]);
+        uint32_t r00 = avancer_noeud(univers, c00, pas_restant);
+        uint32_t r01 = avancer_noeud(univers, c01, pas_restant);
+        uint32_t r10 = avancer_noeud(univers, c10, pas_restant);
+        uint32_t r11 = avancer_noeud(univers, c11, pas_restant);
+        resultat = creer_noeud(univers, r00, r01, r10, r11);
+    }
+
+    if (univers->saturation) return 0;
+    noeud = &univers->noeuds[indice];
+    noeud->resultat = resultat;
+    noeud->pas_resultat = (uint8_t)pas;
+    return resultat;
+}
+
+// Entoure la racine d'un anneau vide : même centre, niveau + 1
+static uint32_t agrandir_racine(UniversHashLife *univers, uint32_t racine) {
+    const uint32_t *enfants = univers->noeuds[racine].enfants;
+    uint32_t vide = univers->vides[univers->noeuds[racine].niveau - 1];
+    uint32_t nw = creer_noeud(univers, vide, vide, vide, enfants[0]);
+    uint32_t ne = creer_noeud(univers, vide, vide, enfants[1], vide);
+    uint32_t sw = creer_noeud(univers, vide, enfants[2], vide, vide);
+    uint32_t se = creer_noeud(univers, enfants[3], vide, vide, vide);
+    return creer_noeud(univers, nw, ne, sw, se);
+}
+
+// Un essai d'avance de 2^pas ; en cas de saturation la racine reste inchangée
+static int essayer_avancer(UniversHashLife *univers, int pas) {
+    uint32_t racine = univers->racine;
+
+    // Le motif doit tenir dans le quart central et la racine couvrir pas + 3 niveaux :
+    // aucune cellule ne peut alors sortir du centre calculé en 2^pas générations
+    while (!univers->saturation) {
+        const NoeudHashLife *noeud = &univers->noeuds[racine];
+        if (noeud->niveau >= pas + 3 &&
+            noeud->population == univers->noeuds[centre_noeud(univers, centre_noeud(univers, racine))].population) {
+            break;
+        }
+        if (noeud->niveau >= NIVEAU_MAX_HASHLIFE) return 0;
+        racine = agrandir_racine(univers, racine);
+    }
+
+    uint32_t resultat = avancer_noeud(univers, racine, pas);
+    if (univers->saturation) return 0;
+
+    univers->racine = resultat;
+    univers->generation += (uint64_t)1 << pas;
+    return 1;
+}
+
+int avancer_hashlife(UniversHashLife *univers, uint32_t log2_generations) {
+    if (!univers || !univers->noeuds || log2_generations > NIVEAU_MAX_HASHLIFE - 3) return 0;
+
+    int pas = (int)log2_generations;
+    if (essayer_avancer(univers, pas)) return 1;
+
+    // Arène pleine : on ne garde que l'arbre courant et on recommence
+    compacter_univers(univers);
+    if (essayer_avancer(univers, pas)) return 1;
+
+    // Toujours trop grand : deux demi-pas
+    compacter_univers(univers);
+    if (pas == 0) return 0;
+    return avancer_hashlife(univers, log2_generations - 1) && avancer_hashlife(univers, log2_generations - 1);
+}
+
+int avancer_hashlife_generations(UniversHashLife *univers, uint64_t generations) {
+    for (uint32_t bit = 0; bit < 64 && generations != 0; bit++) {
+        if ((generations >> bit) & 1u) {
+            if (!avancer_hashlife(univers, bit)) return 0;
+            generations &= ~((uint64_t)1 << bit);
+        }
+    }
+    return 1;
+}
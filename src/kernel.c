@@ -12,29 +12,688 @@ unsigned int multiboot_hdr[] = {
     MULTIBOOT_CHECKSUM
 };
 
+// Valeur placée dans EAX par un chargeur Multiboot, et bit "cmdline valide" des infos
+#define MULTIBOOT_MAGIC_CHARGEUR  0x2BADB002
+#define MULTIBOOT_INFO_CMDLINE    (1u << 2)
+
+// Début de la structure d'informations Multiboot (seuls les champs utiles)
+typedef struct {
+    uint32_t flags;
+    uint32_t mem_lower;
+    uint32_t mem_upper;
+    uint32_t boot_device;
+    uint32_t cmdline;
+} MultibootInfo;
+
 #define LARGEUR_ECRAN   160  // Higher resolution for more detail
 #define HAUTEUR_ECRAN   50   // Higher resolution for more detail
 
-// Buffers statiques pour l'automate évolutif
-static CelluleEvolutive grille_cellules_principales[LARGEUR_ECRAN * HAUTEUR_ECRAN];
-static CelluleEvolutive grille_cellules_calcul[LARGEUR_ECRAN * HAUTEUR_ECRAN];
-static EnvironnementLocal grille_environnement[LARGEUR_ECRAN * HAUTEUR_ECRAN];
+// Port série COM1 et périphérique isa-debug-exit de QEMU
+#define PORT_COM1                 0x3F8
+#define PORT_SORTIE_QEMU          0xF4
+#define CODE_SORTIE_QEMU_SUCCES   0x10  // QEMU termine avec le statut (0x10 << 1) | 1 = 33
+
+// Pile du noyau : GRUB ne fournit pas de pile utilisable
+#define TAILLE_PILE_NOYAU 16384
+static uint8_t pile_noyau[TAILLE_PILE_NOYAU] __attribute__((aligned(16), used));
+
+// Point d'entrée : installe la pile puis appelle kmain(magic, infos multiboot)
+__asm__(
+    ".section .text\n"
+    ".global demarrage_multiboot\n"
+    "demarrage_multiboot:\n"
+    "    mov $pile_noyau + 16384, %esp\n"
+    "    push %ebx\n"
+    "    push %eax\n"
+    "    call kmain\n"
+    "1:  cli\n"
+    "    hlt\n"
+    "    jmp 1b\n"
+);
+
+// Bloc mémoire statique de l'automate (assez grand pour les deux moteurs)
+static uint8_t memoire_automate[TAILLE_MEMOIRE_AUTOMATE(LARGEUR_ECRAN, HAUTEUR_ECRAN)] __attribute__((aligned(16)));
+
+#if MODE_HASHLIFE
+// Arène de noeuds HashLife et grille de la fenêtre affichée
+static uint8_t memoire_hashlife[TAILLE_MEMOIRE_HASHLIFE_NOYAU] __attribute__((aligned(16)));
+static uint8_t memoire_vue_hashlife[TAILLE_MEMOIRE_BITBOARD(LARGEUR_ECRAN, HAUTEUR_ECRAN)] __attribute__((aligned(16)));
+static UniversHashLife univers_hashlife;
+#endif
 
 // Pointeur vers la mémoire VGA pour l'affichage en mode texte
 static volatile uint8_t *memoire_ecran_vga = (volatile uint8_t*)0xB8000;
 
-void kmain(void) {
+// =============================
+// ENTRÉES/SORTIES BAS NIVEAU
+// =============================
+
+static inline void ecrire_port_8(uint16_t port, uint8_t valeur) {
+    __asm__ volatile ("outb %0, %1" : : "a"(valeur), "Nd"(port));
+}
+
+static inline void ecrire_port_32(uint16_t port, uint32_t valeur) {
+    __asm__ volatile ("outl %0, %1" : : "a"(valeur), "Nd"(port));
+}
+
+static inline uint8_t lire_port_8(uint16_t port) {
+    uint8_t valeur;
+    __asm__ volatile ("inb %1, %0" : "=a"(valeur) : "Nd"(port));
+    return valeur;
+}
+
+// Bits des registres de contrôle pour le FPU et SSE
+#define CR0_MP          (1u << 1)   // Monitor coprocessor
+#define CR0_EM          (1u << 2)   // Émulation x87 : doit être à 0
+#define CR0_TS          (1u << 3)   // Task switched : sinon #NM à la première instruction FPU/SSE
+#define CR0_NE          (1u << 5)   // Erreurs x87 natives
+#define CR4_OSFXSR      (1u << 9)   // FXSAVE / FXRSTOR et instructions SSE autorisés
+#define CR4_OSXMMEXCPT  (1u << 10)  // Exceptions SIMD par #XM
+#define MXCSR_DEFAUT    0x1F80u     // Toutes les exceptions SSE masquées, arrondi au plus proche
+
+/**
+ * FPU and SSE bring-up: GRUB hands over with CR0 / CR4 in an unknown state
+ * The x87 unit is always initialized (display and seeding use float); SSE is
+ * only enabled when CPUID reports FXSR, SSE and SSE2
+ * Returns 1 if SSE2 instructions may be used
+ */
+static int activer_fpu_sse(void) {
+    uint32_t cr0;
+    __asm__ volatile ("mov %%cr0, %0" : "=r"(cr0));
+    cr0 = (cr0 & ~(CR0_EM | CR0_TS)) | CR0_MP | CR0_NE;
+    __asm__ volatile ("mov %0, %%cr0" : : "r"(cr0));
+    __asm__ volatile ("fninit");
+
+    uint32_t requises = CPUID_FXSR | CPUID_SSE | CPUID_SSE2;
+    if ((lire_capacites_processeur() & requises) != requises) return 0;
+
+    uint32_t cr4;
+    __asm__ volatile ("mov %%cr4, %0" : "=r"(cr4));
+    cr4 |= CR4_OSFXSR | CR4_OSXMMEXCPT;
+    __asm__ volatile ("mov %0, %%cr4" : : "r"(cr4));
+
+    uint32_t mxcsr = MXCSR_DEFAUT;
+    __asm__ volatile ("ldmxcsr %0" : : "m"(mxcsr));
+    return 1;
+}
+
+// Compteur de cycles du processeur (RDTSC)
+static inline uint64_t lire_compteur_cycles(void) {
+    uint32_t bas, haut;
+    __asm__ volatile ("rdtsc" : "=a"(bas), "=d"(haut));
+    return ((uint64_t)haut << 32) | bas;
+}
+
+// Division 64 bits par décalage-soustraction (pas de libgcc en -nostdlib)
+static uint64_t diviser_64(uint64_t dividende, uint64_t diviseur) {
+    uint64_t quotient = 0, reste = 0;
+    if (diviseur == 0) return 0;
+    for (int bit = 63; bit >= 0; bit--) {
+        reste = (reste << 1) | ((dividende >> bit) & 1);
+        if (reste >= diviseur) {
+            reste -= diviseur;
+            quotient |= (uint64_t)1 << bit;
+        }
+    }
+    return quotient;
+}
+
+// =============================
+// MULTIPROCESSEUR (SMP)
+// =============================
+
+// APIC local : registres (décalages MMIO) et commandes interprocesseurs
+#define APIC_LOCAL_DEFAUT         0xFEE00000u
+#define APIC_REGISTRE_ID          0x020
+#define APIC_REGISTRE_SPURIOUS    0x0F0
+#define APIC_REGISTRE_ICR_BAS     0x300
+#define APIC_REGISTRE_ICR_HAUT    0x310
+#define APIC_ACTIVATION           0x100u      // Bit "APIC software enable" du registre spurious
+#define APIC_VECTEUR_SPURIOUS     0xFFu
+#define APIC_ICR_ENVOI_EN_COURS   (1u << 12)
+#define APIC_ICR_INIT             0x00004500u // INIT, niveau affirmé
+#define APIC_ICR_STARTUP          0x00004600u // STARTUP (SIPI), vecteur dans l'octet bas
+
+// Trampoline des processeurs d'application : mode réel à une adresse alignée sur 4 Kio,
+// sous 1 Mio (le vecteur SIPI en est la page)
+#define ADRESSE_TRAMPOLINE_AP     0x8000u
+#define TAILLE_PILE_PROCESSEUR    16384
+
+// Temporisateur PIT, canal 2 (porte et sortie lues sur le port 0x61)
+#define PORT_PIT_CANAL_2          0x42
+#define PORT_PIT_COMMANDE         0x43
+#define PORT_CONTROLE_SYSTEME     0x61
+#define FREQUENCE_PIT_KHZ         1193u
+
+// Sélecteurs de la GDT du noyau (segments plats de 4 Gio)
+#define SELECTEUR_CODE            0x08
+#define SELECTEUR_DONNEES         0x10
+
+// GDT plate chargée par les processeurs d'application : GRUB ne garantit rien de la sienne
+static const uint64_t gdt_noyau[3] __attribute__((aligned(8), used)) = {
+    0,
+    0x00CF9A000000FFFFull,  // Code 32 bits, base 0, limite 4 Gio
+    0x00CF92000000FFFFull   // Données 32 bits, base 0, limite 4 Gio
+};
+
+// Piles des processeurs d'application (le processeur de démarrage garde pile_noyau)
+static uint8_t piles_processeurs[PROCESSEURS_MAX][TAILLE_PILE_PROCESSEUR] __attribute__((aligned(16)));
+static uint32_t pile_ap_suivante __attribute__((used));  // Sommet de pile du prochain processeur démarré
+
+/**
+ * Application processor start-up code, copied to ADRESSE_TRAMPOLINE_AP: the
+ * processor wakes up in real mode at CS:IP = page:0, loads the kernel GDT
+ * (its descriptor is stored in the trampoline, the only memory it can address
+ * yet), enters protected mode and jumps to entree_ap_32 at its linked address
+ */
+__asm__(
+    ".section .text\n"
+    ".code16\n"
+    ".global trampoline_ap_debut, trampoline_ap_fin\n"
+    "trampoline_ap_debut:\n"
+    "    cli\n"
+    "    xor %ax, %ax\n"
+    "    mov %ax, %ds\n"
+    "    lgdtl 0x8000 + (gdtr_trampoline_ap - trampoline_ap_debut)\n"
+    "    mov %cr0, %eax\n"
+    "    or $1, %eax\n"
+    "    mov %eax, %cr0\n"
+    "    ljmpl $0x08, $entree_ap_32\n"
+    "gdtr_trampoline_ap:\n"
+    "    .word 3 * 8 - 1\n"
+    "    .long gdt_noyau\n"
+    "trampoline_ap_fin:\n"
+    ".code32\n"
+    "entree_ap_32:\n"
+    "    mov $0x10, %ax\n"
+    "    mov %ax, %ds\n"
+    "    mov %ax, %es\n"
+    "    mov %ax, %fs\n"
+    "    mov %ax, %gs\n"
+    "    mov %ax, %ss\n"
+    "    mov pile_ap_suivante, %esp\n"
+    "    call kmain_ap\n"
+    "1:  cli\n"
+    "    hlt\n"
+    "    jmp 1b\n"
+);
+extern const uint8_t trampoline_ap_debut[], trampoline_ap_fin[];
+
+/**
+ * Sense-reversing barrier: the last processor to arrive reloads the counter and
+ * flips the shared sense, the others spin until it matches their own; each
+ * processor keeps its sense from one barrier to the next
+ */
+typedef struct {
+    volatile uint32_t restants;  // Processeurs encore attendus
+    volatile uint32_t sens;      // Sens de la dernière barrière franchie
+    uint32_t participants;
+} BarriereProcesseurs;
+
+static BarriereProcesseurs barriere_generation;
+static uint32_t sens_processeurs[PROCESSEURS_MAX];  // Sens local de chaque processeur
+
+// Travail partagé d'une génération : l'automate, son nombre d'étapes et le bilan de chaque part
+static AutomateCellulaire *automate_partage;
+static uint32_t etapes_generation;
+static BilanPartGeneration bilans_parts[PROCESSEURS_MAX];
+static volatile uint32_t processeurs_demarres;  // Processeurs d'application entrés dans kmain_ap
+static volatile uint32_t processeurs_actifs;    // Nombre de parts, écrit avant de libérer les processeurs
+static uint32_t base_apic_locale = APIC_LOCAL_DEFAUT;
+
+static void franchir_barriere(BarriereProcesseurs *barriere, uint32_t processeur) {
+    uint32_t sens = sens_processeurs[processeur] ^ 1u;
+    sens_processeurs[processeur] = sens;
+    if (__atomic_sub_fetch(&barriere->restants, 1, __ATOMIC_ACQ_REL) == 0) {
+        barriere->restants = barriere->participants;
+        __atomic_store_n(&barriere->sens, sens, __ATOMIC_RELEASE);
+    } else {
+        while (__atomic_load_n(&barriere->sens, __ATOMIC_ACQUIRE) != sens) {
+            __asm__ volatile ("pause");
+        }
+    }
+}
+
+static inline uint32_t lire_apic(uint32_t registre) {
+    return *(volatile uint32_t*)(uintptr_t)(base_apic_locale + registre);
+}
+
+static inline void ecrire_apic(uint32_t registre, uint32_t valeur) {
+    *(volatile uint32_t*)(uintptr_t)(base_apic_locale + registre) = valeur;
+}
+
+// Attente active mesurée par le canal 2 du PIT (mode 0, par tranches de 50 ms au plus)
+static void attendre_microsecondes(uint32_t microsecondes) {
+    while (microsecondes > 0) {
+        uint32_t tranche = (microsecondes > 50000) ? 50000 : microsecondes;
+        uint32_t compte = tranche * FREQUENCE_PIT_KHZ / 1000 + 1;
+        uint8_t controle = lire_port_8(PORT_CONTROLE_SYSTEME) & ~0x03;  // Porte basse, haut-parleur coupé
+        ecrire_port_8(PORT_CONTROLE_SYSTEME, controle);
+        ecrire_port_8(PORT_PIT_COMMANDE, 0xB0);                      // Canal 2, octet bas puis haut, mode 0
+        ecrire_port_8(PORT_PIT_CANAL_2, (uint8_t)compte);
+        ecrire_port_8(PORT_PIT_CANAL_2, (uint8_t)(compte >> 8));
+        ecrire_port_8(PORT_CONTROLE_SYSTEME, controle | 0x01);          // Porte haute : le décompte part
+        while ((lire_port_8(PORT_CONTROLE_SYSTEME) & 0x20) == 0);       // Sortie haute au terme
+        microsecondes -= tranche;
+    }
+}
+
+// Somme des octets d'une table ACPI ou MP (nulle si la table est valide)
+static uint8_t somme_octets(const uint8_t *table, uint32_t longueur) {
+    uint8_t somme = 0;
+    for (uint32_t i = 0; i < longueur; i++) somme += table[i];
+    return somme;
+}
+
+static int signature_egale(const uint8_t *zone, const char *signature, int longueur) {
+    for (int i = 0; i < longueur; i++) {
+        if (zone[i] != (uint8_t)signature[i]) return 0;
+    }
+    return 1;
+}
+
+// Cherche une structure de signature donnée, alignée sur 16 octets, dans [debut, fin)
+static const uint8_t *chercher_signature(uint32_t debut, uint32_t fin, const char *signature, int longueur,
+                                         uint32_t longueur_somme) {
+    for (uint32_t adresse = debut; adresse + longueur_somme <= fin; adresse += 16) {
+        const uint8_t *zone = (const uint8_t*)(uintptr_t)adresse;
+        if (signature_egale(zone, signature, longueur) && somme_octets(zone, longueur_somme) == 0) return zone;
+    }
+    return 0;
+}
+
+// Mot de 16 bits à une adresse physique basse (zone de données du BIOS), lu en assembleur :
+// GCC tient un déréférencement de petite adresse constante pour hors bornes
+static inline uint32_t lire_memoire_16(uint32_t adresse) {
+    uint32_t valeur;
+    __asm__ volatile ("movzwl (%1), %0" : "=r"(valeur) : "r"(adresse) : "memory");
+    return valeur;
+}
+
+// Même recherche dans la zone du BIOS étendu (EBDA, segment en 0x40E) puis dans la ROM du BIOS
+static const uint8_t *chercher_structure_bios(const char *signature, int longueur, uint32_t longueur_somme) {
+    uint32_t ebda = lire_memoire_16(0x40E) << 4;
+    const uint8_t *structure = ebda ? chercher_signature(ebda, ebda + 1024, signature, longueur, longueur_somme) : 0;
+    if (!structure) structure = chercher_signature(0xE0000, 0x100000, signature, longueur, longueur_somme);
+    return structure;
+}
+
+static inline uint32_t lire_32(const uint8_t *octets) {
+    return (uint32_t)octets[0] | ((uint32_t)octets[1] << 8) | ((uint32_t)octets[2] << 16) | ((uint32_t)octets[3] << 24);
+}
+
+// Longueur plafond d'une table du BIOS : au-delà, l'en-tête est tenu pour corrompu
+#define LONGUEUR_TABLE_MAX 0x10000u
+
+// Table ACPI de signature donnée, d'au moins "longueur_min" octets et de somme nulle ;
+// retourne sa longueur, 0 si elle n'est pas valide
+static uint32_t valider_table_acpi(const uint8_t *table, const char *signature, uint32_t longueur_min) {
+    if (!signature_egale(table, signature, 4)) return 0;
+    uint32_t longueur = lire_32(table + 4);
+    if (longueur < longueur_min || longueur > LONGUEUR_TABLE_MAX || somme_octets(table, longueur) != 0) return 0;
+    return longueur;
+}
+
+/**
+ * Local APIC IDs of the enabled processors, from the ACPI MADT (RSDP -> RSDT ->
+ * "APIC", entries of type 0) or else from the MP configuration table (entries
+ * of type 0); also sets base_apic_locale. Every table is checked (signature,
+ * length, checksum) and every entry must fit in its table before it is read, so
+ * a corrupt table is skipped instead of read out of bounds. Returns the number
+ * of IDs found, 0 if neither table is usable
+ */
+static uint32_t decouvrir_processeurs(uint8_t identifiants[], uint32_t capacite) {
+    uint32_t nombre = 0;
+    
+    const uint8_t *rsdp = chercher_structure_bios("RSD PTR ", 8, 20);
+    const uint8_t *rsdt = rsdp ? (const uint8_t*)(uintptr_t)lire_32(rsdp + 16) : 0;
+    uint32_t longueur_rsdt = rsdt ? valider_table_acpi(rsdt, "RSDT", 36) : 0;
+    uint32_t entrees_rsdt = (longueur_rsdt > 36) ? (longueur_rsdt - 36) / 4 : 0;
+    for (uint32_t i = 0; i < entrees_rsdt; i++) {
+        const uint8_t *madt = (const uint8_t*)(uintptr_t)lire_32(rsdt + 36 + 4 * i);
+        uint32_t fin = madt ? valider_table_acpi(madt, "APIC", 44) : 0;
+        if (!fin) continue;
+        
+        base_apic_locale = lire_32(madt + 36);
+        uint32_t decalage = 44;
+        while (decalage + 2 <= fin) {
+            uint32_t longueur = madt[decalage + 1];
+            if (longueur < 2 || decalage + longueur > fin) break;  // Entrée tronquée : fin de la liste
+            // Type 0 : processeur (8 octets), identifiant APIC en +3, indicateur "activé" en +4
+            if (madt[decalage] == 0 && longueur >= 8 && (madt[decalage + 4] & 1) && nombre < capacite) {
+                identifiants[nombre++] = madt[decalage + 3];
+            }
+            decalage += longueur;
+        }
+        return nombre;
+    }
+    
+    const uint8_t *flottante = chercher_structure_bios("_MP_", 4, 16);
+    const uint8_t *configuration = flottante ? (const uint8_t*)(uintptr_t)lire_32(flottante + 4) : 0;
+    if (!configuration || !signature_egale(configuration, "PCMP", 4)) return nombre;
+    
+    // En-tête de 44 octets, longueur de la table de base en +4 (16 bits), somme nulle
+    uint32_t longueur_configuration = (uint32_t)configuration[4] | ((uint32_t)configuration[5] << 8);
+    if (longueur_configuration < 44 || somme_octets(configuration, longueur_configuration) != 0) return nombre;
+    
+    base_apic_locale = lire_32(configuration + 36);
+    uint32_t entrees = (uint32_t)configuration[34] | ((uint32_t)configuration[35] << 8);
+    uint32_t decalage = 44;
+    for (uint32_t i = 0; i < entrees && decalage < longueur_configuration; i++) {
+        // Processeur : 20 octets ; bus, APIC d'E/S, interruptions : 8 octets ; autre type : illisible
+        uint8_t type = configuration[decalage];
+        uint32_t longueur = (type == 0) ? 20 : 8;
+        if (type > 4 || decalage + longueur > longueur_configuration) break;
+        
+        // Identifiant APIC en +1, indicateur "activé" en +3
+        if (type == 0 && (configuration[decalage + 3] & 1) && nombre < capacite) {
+            identifiants[nombre++] = configuration[decalage + 1];
+        }
+        decalage += longueur;
+    }
+    return nombre;
+}
+
+// Commande interprocesseur vers l'APIC d'identifiant donné, puis attente de son envoi
+static void envoyer_ipi(uint8_t identifiant_apic, uint32_t commande) {
+    ecrire_apic(APIC_REGISTRE_ICR_HAUT, (uint32_t)identifiant_apic << 24);
+    ecrire_apic(APIC_REGISTRE_ICR_BAS, commande);
+    while (lire_apic(APIC_REGISTRE_ICR_BAS) & APIC_ICR_ENVOI_EN_COURS) {
+        __asm__ volatile ("pause");
+    }
+}
+
+/**
+ * Entry of an application processor, on its own stack: same FPU / SSE set-up
+ * as the bootstrap processor (the SSE2 kernels are chosen once for all), then
+ * its part of every stage of every generation, each followed by a barrier
+ */
+void kmain_ap(void) {
+    activer_fpu_sse();
+    ecrire_apic(APIC_REGISTRE_SPURIOUS, APIC_ACTIVATION | APIC_VECTEUR_SPURIOUS);
+    uint32_t processeur = __atomic_add_fetch(&processeurs_demarres, 1, __ATOMIC_ACQ_REL);
+    
+    // Attendre que le processeur de démarrage ait compté tous les processeurs
+    while (__atomic_load_n(&processeurs_actifs, __ATOMIC_ACQUIRE) == 0) {
+        __asm__ volatile ("pause");
+    }
+    if (processeur >= processeurs_actifs) {
+        while (1) __asm__ volatile ("cli; hlt");
+    }
+    
+    while (1) {
+        franchir_barriere(&barriere_generation, processeur);
+        // Lu avant la première étape : le processeur de démarrage le réécrit dès la dernière barrière
+        uint32_t nombre_etapes = etapes_generation;
+        for (uint32_t etape = 0; etape < nombre_etapes; etape++) {
+            calculer_etape_generation(automate_partage, etape, processeur, processeurs_actifs, bilans_parts);
+            franchir_barriere(&barriere_generation, processeur);
+        }
+    }
+}
+
+/**
+ * Starts the application processors (INIT, then two STARTUP IPIs to the
+ * trampoline, as in the MultiProcessor Specification), one at a time so that
+ * each takes the next stack; a processor that does not answer within 100 ms
+ * stops the bring-up. Returns the number of processors that will share the
+ * generations, the bootstrap processor included
+ */
+static uint32_t demarrer_processeurs_application(void) {
+    uint8_t identifiants[PROCESSEURS_MAX * 2];
+    uint32_t nombre_identifiants = decouvrir_processeurs(identifiants, PROCESSEURS_MAX * 2);
+    uint32_t nombre_processeurs = 1;
+    
+    if (PROCESSEURS_MAX > 1 && nombre_identifiants > 1) {
+        ecrire_apic(APIC_REGISTRE_SPURIOUS, APIC_ACTIVATION | APIC_VECTEUR_SPURIOUS);
+        uint8_t identifiant_bsp = (uint8_t)(lire_apic(APIC_REGISTRE_ID) >> 24);
+        
+        // Copie du trampoline (destination volatile : pas de memcpy implicite)
+        volatile uint8_t *trampoline = (volatile uint8_t*)ADRESSE_TRAMPOLINE_AP;
+        for (const uint8_t *octet = trampoline_ap_debut; octet < trampoline_ap_fin; octet++) {
+            *trampoline++ = *octet;
+        }
+        
+        for (uint32_t i = 0; i < nombre_identifiants && nombre_processeurs < PROCESSEURS_MAX; i++) {
+            if (identifiants[i] == identifiant_bsp) continue;
+            pile_ap_suivante = (uint32_t)(uintptr_t)&piles_processeurs[nombre_processeurs][TAILLE_PILE_PROCESSEUR];
+            __atomic_thread_fence(__ATOMIC_SEQ_CST);
+            
+            envoyer_ipi(identifiants[i], APIC_ICR_INIT);
+            attendre_microsecondes(10000);
+            for (int envoi = 0; envoi < 2; envoi++) {
+                envoyer_ipi(identifiants[i], APIC_ICR_STARTUP | (ADRESSE_TRAMPOLINE_AP >> 12));
+                attendre_microsecondes(200);
+            }
+            
+            for (int attente = 0; attente < 100 && processeurs_demarres < nombre_processeurs; attente++) {
+                attendre_microsecondes(1000);
+            }
+            if (processeurs_demarres < nombre_processeurs) break;
+            nombre_processeurs++;
+        }
+    }
+    
+    barriere_generation.participants = nombre_processeurs;
+    barriere_generation.restants = nombre_processeurs;
+    __atomic_store_n(&processeurs_actifs, nombre_processeurs, __ATOMIC_RELEASE);
+    return nombre_processeurs;
+}
+
+/**
+ * One generation on every started processor: the bootstrap processor picks the
+ * storage and the stages, a barrier, then every processor runs its rows of each
+ * stage (occupation plane, deferred tiles, environment, rows, ..., movement)
+ * with a barrier after each one, and the bootstrap processor swaps the counters
+ * and the buffers (same result as calculer_generation_suivante)
+ */
+static void calculer_generation_smp(AutomateCellulaire *automate) {
+    if (processeurs_actifs <= 1) {
+        calculer_generation_suivante(automate);
+        return;
+    }
+    etapes_generation = debuter_generation_partagee(automate);
+    automate_partage = automate;
+    franchir_barriere(&barriere_generation, 0);
+    for (uint32_t etape = 0; etape < etapes_generation; etape++) {
+        calculer_etape_generation(automate, etape, 0, processeurs_actifs, bilans_parts);
+        franchir_barriere(&barriere_generation, 0);
+    }
+    terminer_generation_partagee(automate, bilans_parts, processeurs_actifs);
+}
+
+// =============================
+// PORT SÉRIE COM1 (38400 bauds, 8N1)
+// =============================
+
+static void initialiser_port_serie(void) {
+    ecrire_port_8(PORT_COM1 + 1, 0x00);  // Pas d'interruptions
+    ecrire_port_8(PORT_COM1 + 3, 0x80);  // DLAB pour régler la vitesse
+    ecrire_port_8(PORT_COM1 + 0, 0x03);  // Diviseur 3 → 38400 bauds
+    ecrire_port_8(PORT_COM1 + 1, 0x00);
+    ecrire_port_8(PORT_COM1 + 3, 0x03);  // 8 bits, pas de parité, 1 stop
+    ecrire_port_8(PORT_COM1 + 2, 0xC7);  // FIFO activée et vidée
+    ecrire_port_8(PORT_COM1 + 4, 0x03);  // DTR + RTS
+}
+
+static void ecrire_serie_caractere(char caractere) {
+    while ((lire_port_8(PORT_COM1 + 5) & 0x20) == 0);  // Attendre le registre d'émission vide
+    ecrire_port_8(PORT_COM1, (uint8_t)caractere);
+}
+
+static void ecrire_serie_texte(const char *texte) {
+    while (*texte) {
+        if (*texte == '\n') ecrire_serie_caractere('\r');
+        ecrire_serie_caractere(*texte++);
+    }
+}
+
+static void ecrire_serie_nombre(uint64_t nombre) {
+    char chiffres[21];
+    int longueur = 0;
+    do {
+        uint64_t quotient = diviser_64(nombre, 10);
+        chiffres[longueur++] = (char)('0' + (nombre - quotient * 10));
+        nombre = quotient;
+    } while (nombre != 0);
+    while (longueur > 0) ecrire_serie_caractere(chiffres[--longueur]);
+}
+
+// Affiche une valeur en centièmes sous la forme "entier.dd"
+static void ecrire_serie_centiemes(uint64_t centiemes) {
+    uint64_t entier = diviser_64(centiemes, 100);
+    uint32_t fraction = (uint32_t)(centiemes - entier * 100);
+    ecrire_serie_nombre(entier);
+    ecrire_serie_caractere('.');
+    ecrire_serie_caractere((char)('0' + fraction / 10));
+    ecrire_serie_caractere((char)('0' + fraction % 10));
+}
+
+// =============================
+// MODE BENCHMARK
+// =============================
+
+// Lit un entier décimal, retourne 0 si aucun chiffre
+static uint32_t lire_nombre_decimal(const char *texte) {
+    uint32_t valeur = 0;
+    while (*texte >= '0' && *texte <= '9') {
+        valeur = valeur * 10 + (uint32_t)(*texte - '0');
+        texte++;
+    }
+    return valeur;
+}
+
+// Cherche "bench" ou "bench=N" dans la ligne de commande GRUB
+// Retourne le nombre de générations à mesurer, 0 si le mode n'est pas demandé
+static uint32_t lire_mode_benchmark(uint32_t magic, const MultibootInfo *infos) {
+    if (magic != MULTIBOOT_MAGIC_CHARGEUR || !infos || !(infos->flags & MULTIBOOT_INFO_CMDLINE)) return 0;
+
+    const char *caractere = (const char *)(uintptr_t)infos->cmdline;
+    while (*caractere) {
+        // Début d'un mot
+        while (*caractere == ' ') caractere++;
+        const char *mot = caractere;
+        while (*caractere && *caractere != ' ') caractere++;
+
+        if (mot[0] == 'b' && mot[1] == 'e' && mot[2] == 'n' && mot[3] == 'c' && mot[4] == 'h') {
+            if (mot + 5 == caractere) return GENERATIONS_BENCHMARK;
+            if (mot[5] == '=') {
+                uint32_t generations = lire_nombre_decimal(mot + 6);
+                return generations ? generations : GENERATIONS_BENCHMARK;
+            }
+        }
+    }
+    return 0;
+}
+
+/**
+ * Scripted benchmark: runs a fixed number of generations without rendering nor
+ * delay, measures them with RDTSC, reports on COM1 and exits QEMU
+ */
+static void executer_benchmark(AutomateCellulaire *automate, uint32_t nombre_generations, int noyau_sse2) {
+    const char message[] = "CA-BENCH en cours (resultats sur COM1)";
+    for (int i = 0; message[i]; i++) {
+        memoire_ecran_vga[2 * i] = message[i];
+        memoire_ecran_vga[2 * i + 1] = 0x0F;
+    }
+
+    initialiser_port_serie();
+    ecrire_serie_texte("CA-BENCH grille=");
+    ecrire_serie_nombre(automate->largeur_grille);
+    ecrire_serie_texte("x");
+    ecrire_serie_nombre(automate->hauteur_grille);
+    ecrire_serie_texte(" regles=");
+    ecrire_serie_texte(automate->regles_format_texte);
+    ecrire_serie_texte(" generations=");
+    ecrire_serie_nombre(nombre_generations);
+    ecrire_serie_texte(noyau_sse2 ? " noyau=sse2" : " noyau=scalaire");
+    ecrire_serie_texte(" processeurs=");
+    ecrire_serie_nombre(processeurs_actifs);
+    ecrire_serie_texte("\n");
+
+    uint64_t tuiles_calculees = 0, tuiles_environnement = 0, generations_clairsemees = 0;
+    uint64_t debut = lire_compteur_cycles();
+    for (uint32_t generation = 0; generation < nombre_generations; generation++) {
+        calculer_generation_smp(automate);
+        tuiles_calculees += automate->tuiles_calculees;
+        tuiles_environnement += automate->tuiles_environnement;
+        generations_clairsemees += automate->generation_clairsemee;
+    }
+    uint64_t cycles_total = lire_compteur_cycles() - debut;
+
+    uint64_t nombre_cellules = (uint64_t)automate->largeur_grille * automate->hauteur_grille;
+    ecrire_serie_texte("CA-BENCH cycles_total=");
+    ecrire_serie_nombre(cycles_total);
+    ecrire_serie_texte("\nCA-BENCH cycles_par_generation=");
+    ecrire_serie_nombre(diviser_64(cycles_total, nombre_generations));
+    ecrire_serie_texte("\nCA-BENCH cycles_par_cellule=");
+    ecrire_serie_centiemes(diviser_64(cycles_total * 100, nombre_generations * nombre_cellules));
+    ecrire_serie_texte("\nCA-BENCH population_finale=");
+    ecrire_serie_nombre(automate->population_totale);
+    if (automate->moteur == MOTEUR_EVOLUTIF) {
+        // Part des tuiles calculées / dont l'environnement a été mis à jour, et des générations clairsemées
+        uint64_t tuiles_total = (uint64_t)NOMBRE_TUILES(automate->largeur_grille, automate->hauteur_grille) * nombre_generations;
+        ecrire_serie_texte("\nCA-BENCH tuiles_calculees_pct=");
+        ecrire_serie_centiemes(diviser_64(tuiles_calculees * 10000, tuiles_total));
+        ecrire_serie_texte("\nCA-BENCH tuiles_environnement_pct=");
+        ecrire_serie_centiemes(diviser_64(tuiles_environnement * 10000, tuiles_total));
+        ecrire_serie_texte("\nCA-BENCH generations_clairsemees_pct=");
+        ecrire_serie_centiemes(diviser_64(generations_clairsemees * 10000, nombre_generations));
+    }
+    ecrire_serie_texte("\nCA-BENCH fin\n");
+
+    // Quitte QEMU (-device isa-debug-exit,iobase=0xf4,iosize=0x04), sinon reste à l'arrêt
+    ecrire_port_32(PORT_SORTIE_QEMU, CODE_SORTIE_QEMU_SUCCES);
+    while (1) {
+        __asm__ volatile ("cli; hlt");
+    }
+}
+
+#if MODE_HASHLIFE
+/**
+ * HashLife display loop: the initial grid is loaded into the unbounded plane,
+ * and the window centered on it is redrawn every 2^PAS_HASHLIFE generations
+ * Returns only for unsupported rules (B0) or an exhausted arena; the regular loop then runs
+ */
+static void executer_hashlife(const AutomateCellulaire *automate) {
+    AutomateCellulaire vue = {
+        .largeur_grille              = LARGEUR_ECRAN,
+        .hauteur_grille              = HAUTEUR_ECRAN,
+        .regles_format_texte         = automate->regles_format_texte,
+        .moteur                      = MOTEUR_BITBOARD
+    };
+    attacher_memoire_automate(&vue, memoire_vue_hashlife);
+
+    if (!attacher_memoire_hashlife(&univers_hashlife, memoire_hashlife, TAILLE_MEMOIRE_HASHLIFE_NOYAU) ||
+        !charger_hashlife(&univers_hashlife, automate)) {
+        return;
+    }
+
+    while (1) {
+        rasteriser_hashlife(&univers_hashlife, -(LARGEUR_ECRAN / 2), -(HAUTEUR_ECRAN / 2), &vue);
+        afficher_grille_sur_ecran(&vue, memoire_ecran_vga);
+        if (!avancer_hashlife(&univers_hashlife, PAS_HASHLIFE)) return;
+
+        for (volatile uint32_t compteur_delai = 0; compteur_delai < VITESSE_SIMULATION; compteur_delai++);
+    }
+}
+#endif
+
+void kmain(uint32_t magic, const MultibootInfo *infos) {
+    // 0) FPU et SSE : les noyaux SSE2 ne sont choisis que si le processeur les a
+    int noyau_sse2 = selectionner_noyau_sse2(activer_fpu_sse());
+
     // 1) Création de l’objet CA
     AutomateCellulaire mon_automate = {
         .largeur_grille              = LARGEUR_ECRAN,
         .hauteur_grille              = HAUTEUR_ECRAN,
         .regles_format_texte         = REGLES_AUTOMATE,
-        .grille_cellules_actuelles   = grille_cellules_principales,
-        .grille_cellules_suivantes   = grille_cellules_calcul,
-        .grille_environnement        = grille_environnement,
+        .moteur                      = MOTEUR_AUTOMATE,
+        .bord                        = BORD_AUTOMATE,
         .generation_actuelle         = 0,
         .population_totale           = 0
     };
+    attacher_memoire_automate(&mon_automate, memoire_automate);
 
     // 2) Effacer l'écran (fond noir)
     for (int position = 0; position < LARGEUR_ECRAN * HAUTEUR_ECRAN; position++) {
@@ -46,11 +705,28 @@ void kmain(void) {
     analyser_regles_automate(&mon_automate);                    // Analyser les règles "B3/S23"
     initialiser_grille_aleatoire(&mon_automate, 0x94215687);    // Créer une configuration naturelle aléatoire
 
+    // Mode benchmark : option "bench[=N]" de GRUB ou MODE_BENCHMARK à la compilation
+    uint32_t generations_benchmark = lire_mode_benchmark(magic, infos);
+    if (generations_benchmark == 0 && MODE_BENCHMARK) {
+        generations_benchmark = GENERATIONS_BENCHMARK;
+    }
+    
+    // Processeurs d'application : chacun calculera une part de chaque génération
+    demarrer_processeurs_application();
+    
+    if (generations_benchmark > 0) {
+        executer_benchmark(&mon_automate, generations_benchmark, noyau_sse2);
+    }
+
+#if MODE_HASHLIFE
+    executer_hashlife(&mon_automate);
+#endif
+
     // 4) Boucle principale
     while (1) {
         afficher_grille_sur_ecran(&mon_automate, memoire_ecran_vga);  // Affichage sur l'écran
-        calculer_generation_suivante(&mon_automate);                  // Calcul de la prochaine génération
-        
+        calculer_generation_smp(&mon_automate);                       // Calcul de la prochaine génération
+
         // Temporisation configurable (voir VITESSE_SIMULATION dans ca.h)
         for (volatile uint32_t compteur_delai = 0; compteur_delai < VITESSE_SIMULATION; compteur_delai++);
     }